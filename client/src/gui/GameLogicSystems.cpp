@@ -267,7 +267,7 @@ void GameState::updateInvulnerabilitySystem(float deltaTime) {
 }
 
 void GameState::updateCleanupSystem(float deltaTime) {
-    std::vector<ECS::EntityID> toDestroy;
+    auto& commands = m_world.GetCommandBuffer();
     
     auto* positions = m_world.GetAllComponents<rtype::common::components::Position>();
     if (!positions) return;
@@ -292,14 +292,12 @@ void GameState::updateCleanupSystem(float deltaTime) {
         }
         
         if (offScreen) {
-            toDestroy.push_back(entity);
+            commands.DestroyEntity(entity);
         }
     }
     
     // Destroy off-screen entities
-    for (auto entity : toDestroy) {
-        m_world.DestroyEntity(entity);
-    }
+    m_world.FlushCommands();
 }
 
 void GameState::updateCollisionSystem() {
@@ -36,7 +36,7 @@ namespace rtype::client::gui {
 
 namespace rtype::client::controllers::game_controller {
     void handle_join_room_accepted(const packet_t &packet) {
-        JoinRoomAcceptedPacket *p = (JoinRoomAcceptedPacket *) packet.data;
+        JoinRoomAcceptedPacket *p = (JoinRoomAcceptedPacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->roomCode);
@@ -87,7 +87,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_player_disconnect(const packet_t &packet) {
-        PlayerDisconnectPacket *p = (PlayerDisconnectPacket *) packet.data;
+        PlayerDisconnectPacket *p = (PlayerDisconnectPacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->playerId);
@@ -95,7 +95,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_spawn_enemy(const packet_t &packet) {
-        SpawnEnemyPacket *p = (SpawnEnemyPacket *) packet.data;
+        SpawnEnemyPacket *p = (SpawnEnemyPacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->enemyId);
@@ -118,7 +118,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_entity_destroy(const packet_t &packet) {
-        EntityDestroyPacket *p = (EntityDestroyPacket *) packet.data;
+        EntityDestroyPacket *p = (EntityDestroyPacket *) packet.data();
         // Extract endianes
         from_network_endian(p->entityId);
         from_network_endian(p->reason);
@@ -128,7 +128,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_player_join(const packet_t &packet) {
-        PlayerJoinPacket *p = (PlayerJoinPacket *) packet.data;
+        PlayerJoinPacket *p = (PlayerJoinPacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->newPlayerId);
@@ -143,7 +143,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_player_state(const packet_t &packet) {
-        PlayerStatePacket *p = (PlayerStatePacket *) packet.data;
+        PlayerStatePacket *p = (PlayerStatePacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->playerId);
@@ -157,7 +157,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_lobby_state(const packet_t &packet) {
-        LobbyStatePacket *p = (LobbyStatePacket *) packet.data;
+        LobbyStatePacket *p = (LobbyStatePacket *) packet.data();
         using rtype::client::gui::g_lobbyState;
 
         // Extract endianes
@@ -171,7 +171,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_game_start(const packet_t &packet) {
-        const GameStartPacket *p = (const GameStartPacket*)packet.data;
+        const GameStartPacket *p = (const GameStartPacket*)packet.data();
         using rtype::client::gui::g_stateManager;
         using rtype::client::gui::GameState;
         using rtype::client::gui::g_lobbyState;
@@ -202,7 +202,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_spawn_projectile(const packet_t &packet) {
-        SpawnProjectilePacket *p = (SpawnProjectilePacket *) packet.data;
+        SpawnProjectilePacket *p = (SpawnProjectilePacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->projectileId);
@@ -223,7 +223,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_admin_update(const packet_t &packet) {
-        RoomAdminUpdatePacket *p = (RoomAdminUpdatePacket *) packet.data;
+        RoomAdminUpdatePacket *p = (RoomAdminUpdatePacket *) packet.data();
 
         // Extract endianes
         from_network_endian(p->newAdminPlayerId);
@@ -233,7 +233,7 @@ namespace rtype::client::controllers::game_controller {
     }
 
     void handle_player_score_update(const packet_t &packet) {
-        PlayerScoreUpdatePacket *p = (PlayerScoreUpdatePacket *) packet.data;
+        PlayerScoreUpdatePacket *p = (PlayerScoreUpdatePacket *) packet.data();
         from_network_endian(p->playerId);
         from_network_endian(p->score);
 
@@ -250,7 +250,7 @@ namespace rtype::client::controllers::game_controller {
         
         if (!g_gameState) return;
 
-        ShieldStatePacket *p = (ShieldStatePacket*) packet.data;
+        ShieldStatePacket *p = (ShieldStatePacket*) packet.data();
         from_network_endian(p->playerId);
         from_network_endian(p->duration);
 
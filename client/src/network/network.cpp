@@ -48,22 +48,23 @@ namespace rtype::client::gui {
 uint32_t g_playerServerId = 0;
 
 void network::loop_recv() {
-    uint8_t buffer[MAX_PACKET_SIZE];
-    packet_t packet;
+    // Receive straight into a pooled buffer, which becomes the packet storage
+    PacketBuffer buffer = PacketBuffer::allocate(MAX_PACKET_SIZE);
 
     // Use recv() instead of recvfrom() since we used connect() on the UDP socket
 #ifdef _WIN32
-    int n = recv(rtype::client::network::udp_fd, (char*)buffer, sizeof(buffer), MSG_DONTWAIT);
+    int n = recv(rtype::client::network::udp_fd, (char*)buffer.bytes(), buffer.size(), MSG_DONTWAIT);
 #else
-    int n = recv(rtype::client::network::udp_fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    int n = recv(rtype::client::network::udp_fd, buffer.bytes(), buffer.size(), MSG_DONTWAIT);
 #endif
 
     if (n > 0) {
-        PacketManager::deserializePacket(buffer, n, packet);
-
         // For connected UDP socket, we need to create a dummy sockaddr_in for the packet manager
         struct sockaddr_in servaddr{};
-        pm.handlePacketBytes(buffer, n, servaddr);
+        if (n >= (int) PACKET_BUFFER_HEADROOM) {
+            buffer.resize(n - PACKET_BUFFER_HEADROOM);
+            pm.handlePacketBuffer(std::move(buffer), servaddr);
+        }
     } else if (n < 0) {
         // Check if it's just no data available (non-blocking behavior)
 #ifdef _WIN32
@@ -82,11 +83,12 @@ void network::loop_recv() {
 }
 
 void network::loop_send() {
-    std::vector<std::unique_ptr<packet_t> > packets = pm.fetchPacketsToSend();
+    std::vector<std::unique_ptr<packet_t> > packets = pm.fetchDatagramsToSend();
 
     for (auto& packet : packets) {
-        std::vector<uint8_t> serialized = PacketManager::serializePacket(*packet);
-        int bytes_sent = send(rtype::client::network::udp_fd, (const char*)serialized.data(), serialized.size(), 0);
+        size_t serialized_size = 0;
+        const uint8_t *serialized = PacketManager::wireBytes(*packet, &serialized_size);
+        int bytes_sent = send(rtype::client::network::udp_fd, (const char*)serialized, serialized_size, 0);
 
         if (bytes_sent < 0) {
 #ifdef _WIN32
@@ -162,6 +164,9 @@ int network::start_room_connection(const std::string &ip, int port, const std::s
     // Store username globally so JOIN_ROOM_ACCEPTED handler can use it
     g_username = player_name;
     g_playerServerId = 0; // Reset on new connection
+
+    // The server numbers a new session from seqid 1: drop what the last one received and sent
+    pm.clean();
     
     // Persist selection so GameState can create the local entity with correct vessel
     rtype::client::gui::g_selectedVessel = vessel_type;
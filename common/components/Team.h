@@ -14,6 +14,14 @@ namespace rtype::common::components {
 
         Team(TeamType team = TeamType::Neutral, bool friendlyFire = false)
             : team(team), friendlyFire(friendlyFire) {}
+
+        /**
+         * @brief Partition key: the team
+         * @example world.Partition<Team, Team::ByTeam>().Each(TeamType::Enemy, [&](ECS::EntityID enemy) { ... })
+         */
+        struct ByTeam {
+            TeamType operator()(const Team &team) const { return team.team; }
+        };
     };
 }
 #endif // COMMON_COMPONENTS_TEAM_HPP
@@ -90,114 +90,101 @@ private:
     static void checkPlayerVsEnemies(ECS::World& world, const CollisionHandlers& handlers) {
         if (!handlers.onPlayerVsEnemy) return;
 
-        auto* players = world.GetAllComponents<components::Player>();
-        if (!players) return;
+        auto players = world.View<components::Player, components::Position, components::Health>();
+        auto& teams = world.Partition<components::Team, components::Team::ByTeam>();
 
-        for (auto& [player, playerPtr] : *players) {
-            auto* playerPos = world.GetComponent<components::Position>(player);
-            auto* playerHealth = world.GetComponent<components::Health>(player);
-            if (!playerPos || !playerHealth || playerHealth->invulnerable) continue;
+        for (auto [player, playerComp, playerPos, playerHealth] : players) {
+            if (playerHealth.invulnerable) continue;
 
+            const ECS::EntityID playerId = player;
+            const float playerX = playerPos.x, playerY = playerPos.y;
             float playerW, playerH;
             getEntitySize(player, world, playerW, playerH);
 
             // Check vs all enemies
-            auto* enemies = world.GetAllComponents<components::Team>();
-            if (!enemies) continue;
-
-            for (auto& [enemy, teamPtr] : *enemies) {
-                if (enemy == player || teamPtr->team != components::TeamType::Enemy) continue;
-
+            teams.Each(components::TeamType::Enemy, [&](ECS::EntityID enemy) {
                 auto* enemyPos = world.GetComponent<components::Position>(enemy);
-                auto* enemyHealth = world.GetComponent<components::Health>(enemy);
-                if (!enemyPos || !enemyHealth) continue;
+                if (enemy == playerId || !enemyPos || !world.HasComponent<components::Health>(enemy)) return;
 
                 float enemyW, enemyH;
                 getEntitySize(enemy, world, enemyW, enemyH);
 
-                if (checkAABB(playerPos->x, playerPos->y, playerW, playerH,
+                if (checkAABB(playerX, playerY, playerW, playerH,
                              enemyPos->x, enemyPos->y, enemyW, enemyH)) {
                     auto* enemyType = world.GetComponent<components::EnemyTypeComponent>(enemy);
                     if (enemyType && enemyType->type == components::EnemyType::Suicide && handlers.onSuicideExplosion) {
                         handlers.onSuicideExplosion(enemy, world);
                     } else {
-                        handlers.onPlayerVsEnemy(player, enemy, world);
+                        handlers.onPlayerVsEnemy(playerId, enemy, world);
                     }
                 }
-            }
+            });
         }
     }
 
     static void checkPlayerProjectilesVsEnemies(ECS::World& world, const CollisionHandlers& handlers) {
         if (!handlers.onPlayerProjectileVsEnemy) return;
 
-        auto* projectiles = world.GetAllComponents<components::Projectile>();
-        if (!projectiles) return;
+        auto& projectiles = world.Group<>(ECS::With<components::Projectile, components::Team, components::Position>{});
+        auto& teams = world.Partition<components::Team, components::Team::ByTeam>();
 
-        for (auto& [proj, projData] : *projectiles) {
-            auto* projTeam = world.GetComponent<components::Team>(proj);
-            auto* projPos = world.GetComponent<components::Position>(proj);
-            if (!projTeam || !projPos || projTeam->team != components::TeamType::Player) continue;
+        projectiles.Each([&](ECS::EntityID proj, components::Projectile& projData,
+                             components::Team& projTeam, components::Position& projPos) {
+            if (projTeam.team != components::TeamType::Player) return;
 
-            if (projData->distanceTraveled < 1.0f) continue;
+            if (projData.distanceTraveled < 1.0f) return;
 
+            // Handlers may destroy the projectile, copy what is needed afterwards
+            const bool piercing = projData.piercing;
+            const float projX = projPos.x, projY = projPos.y;
             float projW = 20.0f, projH = 10.0f;
 
-            auto* enemies = world.GetAllComponents<components::Team>();
-            if (!enemies) continue;
-
-            for (auto& [enemy, teamPtr] : *enemies) {
-                if (teamPtr->team != components::TeamType::Enemy) continue;
-
+            bool hit = false;
+            teams.Each(components::TeamType::Enemy, [&](ECS::EntityID enemy) {
+                if (hit && !piercing) return;
                 auto* enemyPos = world.GetComponent<components::Position>(enemy);
-                auto* enemyHealth = world.GetComponent<components::Health>(enemy);
-                if (!enemyPos || !enemyHealth) continue;
+                if (!enemyPos || !world.HasComponent<components::Health>(enemy)) return;
 
                 float enemyW, enemyH;
                 getEntitySize(enemy, world, enemyW, enemyH);
 
-                if (checkAABB(projPos->x, projPos->y, projW, projH,
+                if (checkAABB(projX, projY, projW, projH,
                              enemyPos->x, enemyPos->y, enemyW, enemyH)) {
                     handlers.onPlayerProjectileVsEnemy(proj, enemy, world);
-                    if (!projData->piercing) break;
+                    hit = true;
                 }
-            }
-        }
+            });
+        });
     }
 
     static void checkEnemyProjectilesVsPlayers(ECS::World& world, const CollisionHandlers& handlers) {
         if (!handlers.onEnemyProjectileVsPlayer) return;
 
-        auto* projectiles = world.GetAllComponents<components::Projectile>();
-        if (!projectiles) return;
+        auto& projectiles = world.Group<>(ECS::With<components::Projectile, components::Team, components::Position>{});
+        auto players = world.View<components::Player, components::Position, components::Health>();
 
-        for (auto& [proj, projData] : *projectiles) {
-            auto* projTeam = world.GetComponent<components::Team>(proj);
-            auto* projPos = world.GetComponent<components::Position>(proj);
-            if (!projTeam || !projPos || projTeam->team != components::TeamType::Enemy) continue;
+        projectiles.Each([&](ECS::EntityID proj, components::Projectile& projData,
+                             components::Team& projTeam, components::Position& projPos) {
+            if (projTeam.team != components::TeamType::Enemy) return;
 
-            if (projData->distanceTraveled < 1.0f) continue;
+            if (projData.distanceTraveled < 1.0f) return;
 
+            const float projX = projPos.x, projY = projPos.y;
             float projW = 20.0f, projH = 10.0f;
 
-            auto* players = world.GetAllComponents<components::Player>();
-            if (!players) continue;
-
-            for (auto& [player, playerPtr] : *players) {
-                auto* playerPos = world.GetComponent<components::Position>(player);
-                auto* playerHealth = world.GetComponent<components::Health>(player);
-                if (!playerPos || !playerHealth || playerHealth->invulnerable) continue;
+            for (auto [player, playerComp, playerPos, playerHealth] : players) {
+                if (playerHealth.invulnerable) continue;
 
                 float playerW, playerH;
                 getEntitySize(player, world, playerW, playerH);
 
-                if (checkAABB(projPos->x, projPos->y, projW, projH,
-                             playerPos->x, playerPos->y, playerW, playerH)) {
+                if (checkAABB(projX, projY, projW, projH,
+                             playerPos.x, playerPos.y, playerW, playerH)) {
                     handlers.onEnemyProjectileVsPlayer(proj, player, world);
                     break;
                 }
             }
-        }
+        });
     }
 };
 
@@ -53,9 +53,6 @@ namespace rtype::common::systems {
          * Finds all enemies and makes them shoot according to their type.
          */
         static void update(ECS::World& world, float deltaTime, ProjectileCallback createProjectile) {
-            auto* teams = world.GetAllComponents<components::Team>();
-            if (!teams) return;
-
             float playerX = 0.0f;
             float playerY = 0.0f;
             bool playerFound = false;
@@ -73,20 +70,20 @@ namespace rtype::common::systems {
                 }
             }
 
-            for (auto& [entity, teamPtr] : *teams) {
-                if (teamPtr->team != components::TeamType::Enemy) continue;
-                if (!world.GetComponent<components::Health>(entity)) continue;
+            auto& teams = world.Partition<components::Team, components::Team::ByTeam>();
+            teams.Each(components::TeamType::Enemy, [&](ECS::EntityID entity) {
+                if (!world.GetComponent<components::Health>(entity)) return;
 
                 auto* enemyType = world.GetComponent<components::EnemyTypeComponent>(entity);
                 auto* fireRate = world.GetComponent<components::FireRate>(entity);
                 auto* pos = world.GetComponent<components::Position>(entity);
 
-                if (!fireRate || !pos) continue;
-                if (!fireRate->canFire()) continue;
+                if (!fireRate || !pos) return;
+                if (!fireRate->canFire()) return;
 
                 // Enemies that don't shoot (only Suicide)
                 if (enemyType && enemyType->type == components::EnemyType::Suicide) {
-                    continue;
+                    return;
                 }
 
                 // Boss shooting patterns
@@ -135,7 +132,7 @@ namespace rtype::common::systems {
                     createProjectile(entity, pos->x, pos->y, -300.0f, 0.0f);
                     fireRate->shoot();
                 }
-            }
+            });
         }
 
     private:
@@ -28,13 +28,8 @@ namespace rtype::common::systems {
          * @param deltaTime Time elapsed since last update
          */
         static void update(ECS::World& world, float deltaTime) {
-            auto* healthComponents = world.GetAllComponents<components::Health>();
-            
-            if (!healthComponents) return;
-            
-            for (auto& [entity, healthPtr] : *healthComponents) {
-                auto& health = *healthPtr;
-                
+            // Each entity only touches its own Health: split the pool over the world's thread pool
+            world.ParallelEach<components::Health>([deltaTime](components::Health& health) {
                 // Update invulnerability timer
                 if (health.invulnerable && health.invulnerabilityTimer > 0.0f) {
                     health.invulnerabilityTimer -= deltaTime;
@@ -43,13 +38,13 @@ namespace rtype::common::systems {
                         health.invulnerable = false;
                     }
                 }
-                
+
                 // Mark dead entities
                 if (health.currentHp <= 0 && health.isAlive) {
                     health.currentHp = 0;
                     health.isAlive = false;
                 }
-            }
+            });
         }
     };
 }
@@ -71,16 +71,12 @@ namespace rtype::common::systems {
             float nearestDist = homing->detectionRange;
             ECS::EntityID nearestTarget = 0;
             
-            // Search all entities with position and team
-            auto* allTeams = world.GetAllComponents<components::Team>();
-            if (!allTeams) return;
-            
-            for (auto& [entity, team] : *allTeams) {
-                if (entity == projectile) continue;
-                if (team->team != targetTeam) continue;
+            // Search the entities of the target team only
+            world.Partition<components::Team, components::Team::ByTeam>().Each(targetTeam, [&](ECS::EntityID entity) {
+                if (entity == projectile) return;
                 
                 auto* targetPos = world.GetComponent<components::Position>(entity);
-                if (!targetPos) continue;
+                if (!targetPos) return;
                 
                 // Calculate distance
                 float dx = targetPos->x - projPos->x;
@@ -91,7 +87,7 @@ namespace rtype::common::systems {
                     nearestDist = dist;
                     nearestTarget = entity;
                 }
-            }
+            });
             
             if (nearestTarget != 0) {
                 homing->setTarget(nearestTarget);
@@ -18,6 +18,7 @@
 #include <common/components/EnemyType.h>
 #include <common/components/Bounce.h>
 #include <common/components/Team.h>
+#include <common/components/Player.h>
 #include <common/components/Projectile.h>
 #include <common/utils/Config.h>
 #include <cmath>
@@ -37,32 +38,40 @@ namespace rtype::common::systems {
     public:
         /**
          * @brief Update all entities with Position and Velocity
+         *
+         * Expired Bounce components are removed through the command buffers,
+         * at the caller's next sync point (UpdateSystems() or FlushCommands()).
+         *
          * @param world The ECS world
          * @param deltaTime Time elapsed since last update
          */
         static void update(ECS::World& world, float deltaTime) {
-            auto* positions = world.GetAllComponents<components::Position>();
-            auto* velocities = world.GetAllComponents<components::Velocity>();
-
-            if (!positions || !velocities) return;
-
             // Update enemy lifeTime first
-            auto* enemyTypes = world.GetAllComponents<components::EnemyTypeComponent>();
-            if (enemyTypes) {
-                for (auto& [entity, typePtr] : *enemyTypes) {
-                    typePtr->lifeTime += deltaTime;
+            world.ParallelEach<components::EnemyTypeComponent>([deltaTime](components::EnemyTypeComponent& type) {
+                type.lifeTime += deltaTime;
+            });
+
+            // Enemies tracking the player read a copy of its position: the player moves in the same pass
+            components::Position playerSnapshot;
+            const components::Position* playerPos = nullptr;
+            for (auto& [playerEntity, playerPtr] : *world.GetAllComponents<components::Player>()) {
+                if (auto* pos = world.GetComponent<components::Position>(playerEntity)) {
+                    playerSnapshot = *pos;
+                    playerPos = &playerSnapshot;
+                    break; // Only track first player
                 }
             }
 
-            // Iterate over all positions
-            for (auto& [entity, posPtr] : *positions) {
-                auto& pos = *posPtr;
-                auto* vel = world.GetComponent<components::Velocity>(entity);
-
-                if (!vel) continue;
+            // Iterate over all entities with both a position and a velocity. The owning
+            // group keeps them packed at the front of both pools, so this is a linear walk,
+            // split in chunks over the world's thread pool. Each entity only writes its own
+            // components; structural changes are deferred until the walk is over
+            world.ParallelEach(world.Group<components::Position, components::Velocity>(),
+                [&world, playerPos, deltaTime](ECS::EntityID entity, components::Position& pos, components::Velocity& velocity) {
+                auto* vel = &velocity;
 
                 // Handle special enemy behaviors BEFORE position update
-                handleEnemyMovement(world, entity, pos, vel, deltaTime);
+                handleEnemyMovement(world, entity, pos, vel, playerPos, deltaTime);
 
                 // Update position based on velocity
                 pos.x += vel->vx * deltaTime;
@@ -110,7 +119,7 @@ namespace rtype::common::systems {
                         if (reflected && bounce->remaining >= 0) {
                             bounce->remaining -= 1;
                             if (bounce->remaining < 0) {
-                                world.RemoveComponent<components::Bounce>(entity);
+                                world.GetCommandBuffer().RemoveComponent<components::Bounce>(entity);
                             }
                         }
                     }
@@ -125,7 +134,7 @@ namespace rtype::common::systems {
                         vel->vy *= scale;
                     }
                 }
-            }
+            });
         }
 
     private:
@@ -135,10 +144,12 @@ namespace rtype::common::systems {
          * @param entity The entity to handle
          * @param pos Reference to position component
          * @param vel Pointer to velocity component
+         * @param playerPos Position of the tracked player, or nullptr if there is none
          * @param deltaTime Time elapsed since last update
          */
         static void handleEnemyMovement(ECS::World& world, ECS::EntityID entity,
-                                       components::Position& pos, components::Velocity* vel, float deltaTime) {
+                                       components::Position& pos, components::Velocity* vel,
+                                       const components::Position* playerPos, float deltaTime) {
             auto* enemyType = world.GetComponent<components::EnemyTypeComponent>(entity);
             if (!enemyType) return;
 
@@ -160,14 +171,14 @@ namespace rtype::common::systems {
                 handleSnakeMovement(world, entity, pos, vel, *enemyType);
             }
             else if (enemyType->type == components::EnemyType::Suicide) {
-                handleSuicideMovement(world, entity, pos, vel);
+                handleSuicideMovement(world, entity, pos, vel, playerPos);
             }
             else if (enemyType->type == components::EnemyType::Pata) {
                 handlePataMovement(world, entity, pos, vel, *enemyType);
             }
             // Advanced enemy movements
             else if (enemyType->type == components::EnemyType::Flanker) {
-                handleFlankerMovement(world, entity, pos, vel);
+                handleFlankerMovement(world, entity, pos, vel, playerPos);
             }
             else if (enemyType->type == components::EnemyType::Turret) {
                 handleTurretMovement(world, entity, pos, vel);
@@ -247,38 +258,24 @@ namespace rtype::common::systems {
          * @param entity The entity to handle
          * @param pos Reference to position component
          * @param vel Pointer to velocity component
+         * @param playerPos Position of the tracked player, or nullptr if there is none
          */
         static void handleSuicideMovement(ECS::World& world, ECS::EntityID entity,
-                                         components::Position& pos, components::Velocity* vel) {
+                                         components::Position& pos, components::Velocity* vel,
+                                         const components::Position* playerPos) {
             if (!vel) return;
-
-            // Find player
-            auto* players = world.GetAllComponents<components::Player>();
-            if (!players) {
-                // No player found, move left by default
-                vel->vx = -150.0f;
-                vel->vy = 0.0f;
-                return;
-            }
-
-            // Get first player position
-            for (auto& [playerEntity, playerPtr] : *players) {
-                auto* playerPos = world.GetComponent<components::Position>(playerEntity);
-                if (!playerPos) continue;
-
-                // Calculate direction to player
-                float dx = playerPos->x - pos.x;
-                float dy = playerPos->y - pos.y;
-                float distance = std::sqrt(dx * dx + dy * dy);
-
-                if (distance > 0.0f) {
-                    // Normalize and apply speed
-                    const float SUICIDE_SPEED = 200.0f;
-                    vel->vx = (dx / distance) * SUICIDE_SPEED;
-                    vel->vy = (dy / distance) * SUICIDE_SPEED;
-                }
-
-                break; // Only track first player
+            if (!playerPos) return; // No player to track, keep current velocity
+
+            // Calculate direction to player
+            float dx = playerPos->x - pos.x;
+            float dy = playerPos->y - pos.y;
+            float distance = std::sqrt(dx * dx + dy * dy);
+
+            if (distance > 0.0f) {
+                // Normalize and apply speed
+                const float SUICIDE_SPEED = 200.0f;
+                vel->vx = (dx / distance) * SUICIDE_SPEED;
+                vel->vy = (dy / distance) * SUICIDE_SPEED;
             }
         }
 
@@ -311,39 +308,26 @@ namespace rtype::common::systems {
          * @param entity The entity to handle
          * @param pos Reference to position component
          * @param vel Pointer to velocity component
+         * @param playerPos Position of the tracked player, or nullptr if there is none
          */
         static void handleFlankerMovement(ECS::World& world, ECS::EntityID entity,
-                                         components::Position& pos, components::Velocity* vel) {
+                                         components::Position& pos, components::Velocity* vel,
+                                         const components::Position* playerPos) {
             if (!vel) return;
+            if (!playerPos) return; // No player to track, keep current velocity
 
-            // Find player
-            auto* players = world.GetAllComponents<components::Player>();
-            if (!players) {
-                vel->vx = -90.0f;
-                vel->vy = 0.0f;
-                return;
-            }
-
-            // Get first player position
-            for (auto& [playerEntity, playerPtr] : *players) {
-                auto* playerPos = world.GetComponent<components::Position>(playerEntity);
-                if (!playerPos) continue;
-
-                // Move diagonally to match player's Y position
-                const float HORIZONTAL_SPEED = -90.0f;
-                const float VERTICAL_SPEED = 120.0f;
+            // Move diagonally to match player's Y position
+            const float HORIZONTAL_SPEED = -90.0f;
+            const float VERTICAL_SPEED = 120.0f;
 
-                vel->vx = HORIZONTAL_SPEED;
-
-                // Move toward player's Y position
-                float dy = playerPos->y - pos.y;
-                if (std::abs(dy) > 10.0f) {  // Dead zone
-                    vel->vy = (dy > 0.0f) ? VERTICAL_SPEED : -VERTICAL_SPEED;
-                } else {
-                    vel->vy = 0.0f;  // Stop when aligned
-                }
+            vel->vx = HORIZONTAL_SPEED;
 
-                break;
+            // Move toward player's Y position
+            float dy = playerPos->y - pos.y;
+            if (std::abs(dy) > 10.0f) {  // Dead zone
+                vel->vy = (dy > 0.0f) ? VERTICAL_SPEED : -VERTICAL_SPEED;
+            } else {
+                vel->vy = 0.0f;  // Stop when aligned
             }
         }
 
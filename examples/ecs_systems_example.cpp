@@ -50,24 +50,19 @@ public:
  */
 class MovementSystem : public ECS::System {
 public:
-    MovementSystem() : ECS::System("MovementSystem", 10) {}
+    MovementSystem() : ECS::System("MovementSystem", 10) {
+        RequireComponents<Position, Velocity>();
+    }
 
     void Update(ECS::World& world, float deltaTime) override {
-        auto* positions = world.GetAllComponents<Position>();
-        auto* velocities = world.GetAllComponents<Velocity>();
-
-        if (!positions || !velocities) return;
-
-        // Iterate through all entities that have both Position and Velocity
-        for (ECS::EntityID entity : world.GetAllEntities()) {
-            if (world.HasComponent<Position>(entity) && world.HasComponent<Velocity>(entity)) {
-                auto* pos = world.GetComponent<Position>(entity);
-                auto* vel = world.GetComponent<Velocity>(entity);
-
-                pos->x += vel->vx * deltaTime;
-                pos->y += vel->vy * deltaTime;
-            }
-        }
+        // Iterate through all entities whose signature has both Position and Velocity
+        world.EachEntity(GetSignature(), [&world, deltaTime](ECS::EntityID entity) {
+            auto* pos = world.GetComponent<Position>(entity);
+            auto* vel = world.GetComponent<Velocity>(entity);
+
+            pos->x += vel->vx * deltaTime;
+            pos->y += vel->vy * deltaTime;
+        });
     }
 
     void Initialize(ECS::World& world) override {
@@ -16,18 +16,18 @@ void onPingReceived(const packet_t& packet) {
 }
 
 void onPlayerJoinReceived(const packet_t& packet) {
-    // The callback handles the casting of packet.data
-    if (packet.header.data_size >= sizeof(PlayerJoinPacket) && packet.data) {
-        const PlayerJoinPacket* joinData = static_cast<const PlayerJoinPacket*>(packet.data);
+    // The callback handles the casting of packet.data()
+    if (packet.header.data_size >= sizeof(PlayerJoinPacket) && packet.data()) {
+        const PlayerJoinPacket* joinData = static_cast<const PlayerJoinPacket*>(packet.data());
         std::cout << "Player joined: ID=" << joinData->newPlayerId
                   << ", Name=" << joinData->name << std::endl;
     }
 }
 
 void onPlayerStateReceived(const packet_t& packet) {
-    // The callback handles the casting of packet.data
-    if (packet.header.data_size >= sizeof(PlayerStatePacket) && packet.data) {
-        const PlayerStatePacket* stateData = static_cast<const PlayerStatePacket*>(packet.data);
+    // The callback handles the casting of packet.data()
+    if (packet.header.data_size >= sizeof(PlayerStatePacket) && packet.data()) {
+        const PlayerStatePacket* stateData = static_cast<const PlayerStatePacket*>(packet.data());
         std::cout << "Player state update: ID=" << stateData->playerId
                   << ", Position=(" << stateData->x << "," << stateData->y << ")"
                   << ", HP=" << stateData->hp << std::endl;
@@ -35,9 +35,9 @@ void onPlayerStateReceived(const packet_t& packet) {
 }
 
 void onMissileSpawnReceived(const packet_t& packet) {
-    // The callback handles the casting of packet.data
-    if (packet.header.data_size >= sizeof(MissileSpawnPacket) && packet.data) {
-        const MissileSpawnPacket* missileData = static_cast<const MissileSpawnPacket*>(packet.data);
+    // The callback handles the casting of packet.data()
+    if (packet.header.data_size >= sizeof(MissileSpawnPacket) && packet.data()) {
+        const MissileSpawnPacket* missileData = static_cast<const MissileSpawnPacket*>(packet.data());
         std::cout << "Missile spawned: ID=" << missileData->missileId
                   << ", Owner=" << missileData->ownerId
                   << ", Position=(" << missileData->x << "," << missileData->y << ")"
@@ -74,7 +74,7 @@ int main() {
     std::cout << "3. PacketManager.handlePacketBytes() processes raw data" << std::endl;
     std::cout << "4. PacketManager.fetchReceivedPackets() returns parsed packets" << std::endl;
     std::cout << "5. PacketHandler.processPackets() calls registered callbacks" << std::endl;
-    std::cout << "6. Each callback receives packet_t and casts packet.data as needed" << std::endl;
+    std::cout << "6. Each callback receives packet_t and casts packet.data() as needed" << std::endl;
 
     // In a real application, you would:
     /*
@@ -0,0 +1,416 @@
+/**
+ * @file CommandBuffer.h
+ * @brief Deferred structural changes for the ECS
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the CommandBuffer class, which records entity creation,
+ * destruction and component addition/removal while systems iterate storage,
+ * and the CommandQueue that hands one buffer to each thread. Recorded
+ * commands are played back by the SystemManager at the end of each stage of
+ * systems (or by World::FlushCommands()).
+ */
+
+#ifndef ECS_COMMANDBUFFER_HPP
+#define ECS_COMMANDBUFFER_HPP
+
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    // Forward declaration
+    class World;
+
+    /**
+     * @brief Records structural changes and applies them later, in order
+     *
+     * Destroying entities or adding/removing components while iterating a
+     * pool reorders that pool. Systems record such changes here instead and
+     * the buffer applies them at a sync point where nothing is iterating.
+     *
+     * Playback rules:
+     * - commands run in the order they were recorded;
+     * - destroy, add and remove commands targeting an entity that is no
+     *   longer alive are skipped, so recording the same destroy twice is
+     *   harmless;
+     * - commands recorded during playback (from a callback) run in the same
+     *   playback.
+     *
+     * Commands are written back to back into blocks of raw storage, each
+     * followed by its callback object (a captured component, a lambda's
+     * captures), so no callback is heap-allocated on its own. The blocks
+     * are kept between frames: steady-state recording does not allocate.
+     *
+     * @example
+     * auto& commands = world.GetCommandBuffer();
+     * for (auto& [entity, health] : *world.GetAllComponents<Health>()) {
+     *     if (health->currentHp <= 0) commands.DestroyEntity(entity);
+     * }
+     */
+    class CommandBuffer {
+    private:
+        /**
+         * @brief Kind of a recorded command
+         */
+        enum class CommandType : std::uint8_t {
+            Create,     ///< Create an entity, then run the callback on it
+            Destroy,    ///< Run the callback (if any), then destroy the entity
+            Apply       ///< Run the callback on the entity (component add/remove)
+        };
+
+        /**
+         * @brief Header of a recorded command, followed in its block by the callback object
+         */
+        struct Command {
+            CommandType type;
+            EntityID entity;
+
+            /**
+             * @brief Calls the stored callback, nullptr for commands without one
+             */
+            void (*invoke)(void* callback, World& world, EntityID entity);
+
+            /**
+             * @brief Destroys the stored callback, nullptr if trivially destructible
+             */
+            void (*destroy)(void* callback);
+
+            /**
+             * @brief Bytes taken by the command in its block, callback and padding included
+             */
+            std::size_t size;
+        };
+
+        /**
+         * @brief Fixed chunk of command storage, never moved once allocated
+         */
+        struct Block {
+            std::unique_ptr<unsigned char[]> bytes;
+            std::size_t capacity = 0;
+            std::size_t used = 0;
+        };
+
+        /**
+         * @brief Default block capacity; larger commands get a block of their own size
+         */
+        static constexpr std::size_t BLOCK_SIZE = 4096;
+
+        /**
+         * @brief Rounds a size up so that the next command stays max_align_t aligned
+         */
+        static constexpr std::size_t AlignUp(std::size_t size) {
+            return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        }
+
+        /**
+         * @brief Offset of the callback object from the start of its command
+         */
+        static constexpr std::size_t CALLBACK_OFFSET =
+            (sizeof(Command) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        /**
+         * @brief Blocks in recording order; those after m_current are kept empty for reuse
+         */
+        std::vector<Block> m_blocks;
+
+        /**
+         * @brief Block the next command is written to
+         */
+        std::size_t m_current = 0;
+
+        /**
+         * @brief Number of recorded commands not yet played back
+         */
+        std::size_t m_count = 0;
+
+        template<typename Callable>
+        static void InvokeCallback(void* callback, World& world, EntityID entity) {
+            (*static_cast<Callable*>(callback))(world, entity);
+        }
+
+        template<typename Callable>
+        static void DestroyCallback(void* callback) {
+            static_cast<Callable*>(callback)->~Callable();
+        }
+
+        /**
+         * @brief Finds room for a command at the end of the storage, moving to the next block if needed
+         *
+         * @param size Bytes the command needs
+         * @return unsigned char* Where to write it; nothing is recorded until Commit()
+         */
+        unsigned char* Reserve(std::size_t size);
+
+        /**
+         * @brief Records the command written at the address returned by Reserve()
+         *
+         * @param size Bytes the command takes
+         */
+        void Commit(std::size_t size);
+
+        /**
+         * @brief Destroys the callbacks of the recorded commands and empties the blocks
+         */
+        void Reset();
+
+        /**
+         * @brief Records a command without callback
+         */
+        void Record(CommandType type, EntityID entity) {
+            const std::size_t size = CALLBACK_OFFSET;
+            new (Reserve(size)) Command{type, entity, nullptr, nullptr, size};
+            Commit(size);
+        }
+
+        /**
+         * @brief Records a command and stores its callback inline, after the header
+         */
+        template<typename F>
+        void Record(CommandType type, EntityID entity, F&& callback) {
+            using Callable = std::decay_t<F>;
+            static_assert(std::is_invocable_v<Callable&, World&, EntityID>,
+                          "Command callbacks take (World&, EntityID)");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Over-aligned command callback");
+
+            const std::size_t size = AlignUp(CALLBACK_OFFSET + sizeof(Callable));
+            unsigned char* command = Reserve(size);
+            new (command + CALLBACK_OFFSET) Callable(std::forward<F>(callback));
+            new (command) Command{type, entity, &InvokeCallback<Callable>,
+                                  std::is_trivially_destructible_v<Callable> ? nullptr : &DestroyCallback<Callable>,
+                                  size};
+            Commit(size);
+        }
+
+    public:
+        CommandBuffer() = default;
+
+        /**
+         * @brief Destroys the callbacks of the commands never played back
+         */
+        ~CommandBuffer() { Reset(); }
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        /**
+         * @brief Records the creation of an entity
+         */
+        void CreateEntity() {
+            Record(CommandType::Create, INVALID_ENTITY);
+        }
+
+        /**
+         * @brief Records the creation of an entity, then a call with the new entity
+         *
+         * @tparam F Callable taking (World&, EntityID)
+         * @param init Function called with the new entity, typically to add its components
+         */
+        template<typename F>
+        void CreateEntity(F&& init) {
+            Record(CommandType::Create, INVALID_ENTITY, std::forward<F>(init));
+        }
+
+        /**
+         * @brief Records the destruction of an entity
+         *
+         * @param entity The EntityID to destroy
+         */
+        void DestroyEntity(EntityID entity) {
+            Record(CommandType::Destroy, entity);
+        }
+
+        /**
+         * @brief Records the destruction of an entity, with a last call before it
+         *
+         * @tparam F Callable taking (World&, EntityID)
+         * @param entity The EntityID to destroy
+         * @param beforeDestroy Function called right before destruction,
+         *        only if the entity is still alive (e.g. to broadcast it once)
+         */
+        template<typename F>
+        void DestroyEntity(EntityID entity, F&& beforeDestroy) {
+            Record(CommandType::Destroy, entity, std::forward<F>(beforeDestroy));
+        }
+
+        /**
+         * @brief Records the destruction of a batch of entities
+         *
+         * @tparam Range Any iterable of EntityID
+         * @param entities The entities to destroy
+         */
+        template<typename Range>
+        void DestroyEntities(const Range& entities) {
+            for (EntityID entity : entities) {
+                Record(CommandType::Destroy, entity);
+            }
+        }
+
+        /**
+         * @brief Records the addition of a component
+         *
+         * The component is constructed now, stored in the buffer and moved
+         * into the world at playback, so T must be move-constructible.
+         *
+         * @tparam T The component type to add
+         * @tparam Args The argument types for the component constructor
+         * @param entity The EntityID to add the component to
+         * @param args Arguments to forward to the component constructor
+         */
+        template<typename T, typename... Args>
+        void AddComponent(EntityID entity, Args&&... args) {
+            Record(CommandType::Apply, entity,
+                [component = T(std::forward<Args>(args)...)](auto& world, EntityID target) mutable {
+                    world.template AddComponent<T>(target, std::move(component));
+                });
+        }
+
+        /**
+         * @brief Records the removal of a component
+         *
+         * @tparam T The component type to remove
+         * @param entity The EntityID to remove the component from
+         */
+        template<typename T>
+        void RemoveComponent(EntityID entity) {
+            Record(CommandType::Apply, entity, [](auto& world, EntityID target) {
+                world.template RemoveComponent<T>(target);
+            });
+        }
+
+        /**
+         * @brief Records an arbitrary function to run against an entity
+         *
+         * Meant for work touching storage the recording system did not
+         * declare, such as spawning entities from a parallel system.
+         *
+         * @tparam F Callable taking (World&, EntityID)
+         * @param entity The EntityID the function is about; skipped if no longer alive
+         * @param action Function to run at playback
+         */
+        template<typename F>
+        void Defer(EntityID entity, F&& action) {
+            Record(CommandType::Apply, entity, std::forward<F>(action));
+        }
+
+        /**
+         * @brief Applies every recorded command to the world, then clears the buffer
+         *
+         * @param world The world to apply the commands to
+         */
+        void Playback(World& world);
+
+        /**
+         * @brief Drops every recorded command without applying it
+         */
+        void Clear() { Reset(); }
+
+        /**
+         * @brief Gets the number of recorded commands
+         * @return std::size_t Command count
+         */
+        std::size_t Size() const { return m_count; }
+
+        /**
+         * @brief Checks whether the buffer has no recorded command
+         * @return true if empty, false otherwise
+         */
+        bool Empty() const { return m_count == 0; }
+    };
+
+    /**
+     * @brief One CommandBuffer per recording thread
+     *
+     * Worker threads record into their own buffer without contention; the
+     * only lock is taken when a thread fetches its buffer. Playback applies
+     * the buffers one after the other, in the order the threads first
+     * requested them, and must run on a single thread.
+     */
+    class CommandQueue {
+    private:
+        /**
+         * @brief Protects m_buffers
+         */
+        mutable std::mutex m_mutex;
+
+        /**
+         * @brief Buffers and the thread owning each of them
+         */
+        std::vector<std::pair<std::thread::id, std::unique_ptr<CommandBuffer>>> m_buffers;
+
+        /**
+         * @brief Buffer temporarily standing in for a thread's own buffer
+         */
+        struct Binding {
+            const CommandQueue* queue = nullptr;
+            CommandBuffer* buffer = nullptr;
+        };
+
+        /**
+         * @brief Current binding of the calling thread
+         */
+        static thread_local Binding t_binding;
+
+    public:
+        /**
+         * @brief Redirects Local() of the calling thread to a given buffer for a scope
+         *
+         * Used by the SystemManager so that each system records into its own
+         * buffer whatever worker runs it.
+         */
+        class ScopedBinding {
+        private:
+            Binding m_previous;
+
+        public:
+            /**
+             * @brief Binds a buffer to the calling thread for the given queue
+             *
+             * @param queue The queue whose Local() is redirected
+             * @param buffer The buffer to return instead
+             */
+            ScopedBinding(const CommandQueue& queue, CommandBuffer& buffer) : m_previous(t_binding) {
+                t_binding = {&queue, &buffer};
+            }
+
+            /**
+             * @brief Restores the previous binding
+             */
+            ~ScopedBinding() { t_binding = m_previous; }
+
+            ScopedBinding(const ScopedBinding&) = delete;
+            ScopedBinding& operator=(const ScopedBinding&) = delete;
+        };
+
+        /**
+         * @brief Gets the buffer of the calling thread, creating it on first use
+         *
+         * Returns the bound buffer instead while a ScopedBinding for this
+         * queue is active on the calling thread.
+         *
+         * @return CommandBuffer& The calling thread's buffer, valid for the queue's lifetime
+         */
+        CommandBuffer& Local();
+
+        /**
+         * @brief Plays back every thread's buffer
+         *
+         * @param world The world to apply the commands to
+         */
+        void Playback(World& world);
+
+        /**
+         * @brief Drops every recorded command of every thread
+         */
+        void Clear();
+    };
+}
+
+#endif // ECS_COMMANDBUFFER_HPP
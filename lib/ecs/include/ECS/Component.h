@@ -5,107 +5,123 @@
  * @date 2025
  *
  * This file contains the foundational component classes and type registration
- * system used throughout the ECS. It provides automatic type ID generation
- * for components and establishes the component inheritance hierarchy.
+ * system used throughout the ECS. It provides automatic dense type ID
+ * generation for components and the optional Component<T> CRTP base.
  */
 
 #ifndef ECS_COMPONENT_HPP
 #define ECS_COMPONENT_HPP
 
 #include "Types.h"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
 
 namespace ECS {
-    /**
-     * @brief Abstract interface for all components
-     *
-     * IComponent provides the base interface that all components must implement.
-     * It ensures that every component can provide its type ID for runtime
-     * type identification and component system operations.
-     */
-    class IComponent {
-    public:
-        /**
-         * @brief Virtual destructor for proper polymorphic cleanup
-         */
-        virtual ~IComponent() = default;
-
-        /**
-         * @brief Gets the runtime type ID of this component
-         *
-         * @return ComponentTypeID The unique type identifier for this component
-         */
-        virtual ComponentTypeID GetTypeID() const = 0;
-    };
-
     /**
      * @brief Registry system for automatic component type ID generation
      *
-     * ComponentTypeRegistry provides a centralized system for assigning
-     * unique type IDs to component types. It uses template specialization
-     * to ensure each component type gets exactly one unique ID that persists
-     * throughout the program's lifetime.
+     * ComponentTypeRegistry hands out dense type IDs (1, 2, 3, ...) so that
+     * they can index flat per-type tables and Signature bits. Each type's ID
+     * is a constant-initialized global assigned on first use, so a lookup is
+     * an acquire load and a well-predicted branch, with no initialization
+     * guard. Lookups are thread-safe: the first lookup of a type takes a
+     * registry-wide mutex, so threads meeting new types concurrently still
+     * get distinct IDs and all agree on each type's ID. Numbering follows
+     * first use, so IDs may differ between runs if threads race to register.
      */
     class ComponentTypeRegistry {
     private:
         /**
          * @brief Generates the next available component type ID
          *
-         * Uses a static counter to ensure unique IDs are generated.
-         * Thread-safe within single-threaded applications.
+         * Uses a function-local static counter to ensure unique IDs are generated.
+         * Not synchronized itself: only called by Resolve(), under its mutex.
          *
          * @return ComponentTypeID The next available unique type ID
+         * @throws std::runtime_error if more than MAX_COMPONENT_TYPES - 1 types are registered
          */
         static ComponentTypeID GetNextTypeID() {
             static ComponentTypeID nextID = 1;
+            if (nextID >= MAX_COMPONENT_TYPES) {
+                throw std::runtime_error("ECS: too many component types, raise MAX_COMPONENT_TYPES");
+            }
             return nextID++;
         }
 
+        /**
+         * @brief Assigns an ID to a type slot if it does not have one yet
+         *
+         * Serialized, so two threads looking up new types at the same time
+         * get distinct IDs.
+         *
+         * @param slot The zero-initialized ID storage of a type
+         * @return ComponentTypeID The (possibly newly assigned) ID
+         */
+        static ComponentTypeID Resolve(std::atomic<ComponentTypeID>& slot) {
+            static std::mutex mutex;
+            std::lock_guard<std::mutex> lock(mutex);
+            ComponentTypeID typeID = slot.load(std::memory_order_relaxed);
+            if (typeID == 0) {
+                typeID = GetNextTypeID();
+                slot.store(typeID, std::memory_order_release);
+            }
+            return typeID;
+        }
+
+        /**
+         * @brief Storage for the ID of type T
+         *
+         * Constant-initialized to 0 (no static-init guard), assigned on the
+         * first lookup of T.
+         */
+        template<typename T>
+        static inline std::atomic<ComponentTypeID> s_typeID{0};
+
     public:
         /**
-         * @brief Gets or creates a unique type ID for component type T
+         * @brief Gets the unique type ID for component type T
          *
          * Each component type gets exactly one type ID that is consistent
-         * across all instances and calls. The ID is generated on first access
-         * and cached for subsequent calls.
+         * across all instances and calls. Safe to call from any thread; only
+         * the first call for T locks.
          *
          * @tparam T The component type to get an ID for
          * @return ComponentTypeID The unique type ID for component type T
          */
         template<typename T>
         static ComponentTypeID GetTypeID() {
-            static ComponentTypeID typeID = GetNextTypeID();
-            return typeID;
+            const ComponentTypeID typeID = s_typeID<T>.load(std::memory_order_acquire);
+            return typeID != 0 ? typeID : Resolve(s_typeID<T>);
         }
     };
 
     /**
-     * @brief Template base class for all concrete components
-     *
-     * Component<T> provides the standard implementation of IComponent
-     * for concrete component types. It automatically handles type ID
-     * generation and provides both instance and static access to the type ID.
+     * @brief Optional CRTP base class for components
      *
-     * All game components should inherit from Component<ComponentType>
-     * using the Curiously Recurring Template Pattern (CRTP).
+     * Component<T> is an empty, non-virtual base: it adds no vptr and no
+     * storage, so a component made of plain fields stays trivially copyable
+     * and as small as its fields. Deriving from it is only a convenience
+     * giving T::GetStaticTypeID(); any type can be stored as a component.
      *
      * @tparam T The derived component type (CRTP parameter)
      *
      * @example
-     * class PositionComponent : public Component<PositionComponent> {
+     * struct PositionComponent : ECS::Component<PositionComponent> {
      *     float x, y;
-     * public:
-     *     PositionComponent(float x, float y) : x(x), y(y) {}
+     *     PositionComponent(float x = 0.0f, float y = 0.0f) : x(x), y(y) {}
      * };
      */
     template<typename T>
-    class Component : public IComponent {
+    class Component {
     public:
         /**
          * @brief Gets the type ID of this component instance
          *
          * @return ComponentTypeID The unique type ID for this component type
          */
-        ComponentTypeID GetTypeID() const override {
+        ComponentTypeID GetTypeID() const {
             return GetStaticTypeID();
         }
 
@@ -121,6 +137,33 @@ namespace ECS {
             return ComponentTypeRegistry::GetTypeID<T>();
         }
     };
+
+    /**
+     * @brief Whether a component type can be copied with memcpy
+     *
+     * True for components made only of plain fields. Storage uses this to
+     * pick bulk copies over per-element copy construction.
+     *
+     * @tparam T The component type
+     */
+    template<typename T>
+    inline constexpr bool IS_TRIVIAL_COMPONENT = std::is_trivially_copyable_v<T>;
+
+    /**
+     * @brief Builds the signature of a set of component types
+     *
+     * @tparam Ts The component types
+     * @return Signature A signature with the bit of each type set
+     *
+     * @example
+     * const ECS::Signature movable = ECS::MakeSignature<Position, Velocity>();
+     */
+    template<typename... Ts>
+    Signature MakeSignature() {
+        Signature signature;
+        (signature.set(Component<Ts>::GetStaticTypeID()), ...);
+        return signature;
+    }
 }
 
 #endif // ECS_COMPONENT_HPP
@@ -14,11 +14,31 @@
 
 #include "Types.h"
 #include "Component.h"
+#include "SparseSet.h"
+#include "Slab.h"
+#include "Group.h"
+#include "Signal.h"
+#include "Index.h"
+#include "Tag.h"
+#include "Partition.h"
+#include "Profiler.h"
 #include <unordered_map>
 #include <memory>
 #include <vector>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <typeinfo>
+#include <typeindex>
+#include <stdexcept>
 #include <algorithm>
+#include <cstring>
+#include <new>
 
 namespace ECS {
     /**
@@ -45,14 +65,160 @@ namespace ECS {
          * @brief Clears all components from this array
          */
         virtual void Clear() = 0;
+
+        /**
+         * @brief Gets the number of bytes one component takes in a snapshot
+         *
+         * @return std::size_t sizeof(T) for trivially copyable types, 0 for
+         *         types that are left out of snapshots
+         */
+        virtual std::size_t GetSnapshotSize() const = 0;
+
+        /**
+         * @brief Gets a hash of the component type name, checked on restore
+         * @return std::uint64_t Type name hash
+         */
+        virtual std::uint64_t GetTypeHash() const = 0;
+
+        /**
+         * @brief Gets the (implementation-defined) name of the component type
+         * @return const char* typeid(T).name()
+         */
+        virtual const char* GetTypeName() const = 0;
+
+        /**
+         * @brief Gets the number of stored components
+         * @return std::size_t Component count
+         */
+        virtual std::size_t GetComponentCount() const = 0;
+
+        /**
+         * @brief Copies every component and its owner, in dense order
+         *
+         * @param entities Receives GetComponentCount() entity handles
+         * @param bytes Receives GetComponentCount() * GetSnapshotSize() bytes
+         */
+        virtual void CopyAll(EntityID* entities, unsigned char* bytes) const = 0;
+
+        /**
+         * @brief Copies the component of one entity
+         *
+         * @param entity The EntityID whose component is copied
+         * @param bytes Receives GetSnapshotSize() bytes
+         * @return true if the entity has the component
+         */
+        virtual bool CopyComponent(EntityID entity, unsigned char* bytes) const = 0;
+
+        /**
+         * @brief Stores a component from its bytes, replacing the current one if any
+         *
+         * Raw storage only: signatures, groups and signals are the
+         * ComponentManager's job.
+         *
+         * @param entity The EntityID receiving the component
+         * @param bytes GetSnapshotSize() bytes produced by CopyAll()/CopyComponent()
+         */
+        virtual void AssignComponent(EntityID entity, const unsigned char* bytes) = 0;
+    };
+
+    /**
+     * @brief Hashes a component type name (FNV-1a)
+     *
+     * @tparam T The component type
+     * @return std::uint64_t Hash of typeid(T).name()
+     */
+    template<typename T>
+    std::uint64_t TypeNameHash() {
+        static const std::uint64_t hash = [] {
+            std::uint64_t value = 14695981039346656037ull;
+            for (const char* c = typeid(T).name(); *c; ++c) {
+                value = (value ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+            }
+            return value;
+        }();
+        return hash;
+    }
+
+    /**
+     * @brief Non-owning pointer to a component stored inside a ComponentArray
+     *
+     * ComponentPtr is what component iteration yields as the second member of
+     * each (entity, component) pair. It mimics the subset of the smart pointer
+     * interface the game code relies on (get(), ->, *, boolean test) without
+     * owning the component, which lives in the array's packed storage.
+     *
+     * The pointer stays valid while components are added to the array (its
+     * slabs never move), but not across a removal from it, which moves the
+     * last component into the freed slot, nor across a reorder by an owning
+     * group.
+     *
+     * @tparam T The component type (possibly const-qualified)
+     */
+    template<typename T>
+    class ComponentPtr {
+    private:
+        T* m_ptr = nullptr;
+
+    public:
+        /**
+         * @brief Constructs a null component pointer
+         */
+        ComponentPtr() = default;
+
+        /**
+         * @brief Wraps a raw component pointer
+         * @param ptr Pointer to the component
+         */
+        explicit ComponentPtr(T* ptr) : m_ptr(ptr) {}
+
+        /**
+         * @brief Gets the raw component pointer
+         * @return T* Pointer to the component
+         */
+        T* get() const { return m_ptr; }
+
+        /**
+         * @brief Member access to the component
+         * @return T* Pointer to the component
+         */
+        T* operator->() const { return m_ptr; }
+
+        /**
+         * @brief Dereferences the component
+         * @return T& Reference to the component
+         */
+        T& operator*() const { return *m_ptr; }
+
+        /**
+         * @brief Checks whether the pointer refers to a component
+         * @return true if non-null, false otherwise
+         */
+        explicit operator bool() const { return m_ptr != nullptr; }
     };
 
     /**
      * @brief Template class for storing components of a specific type
      *
-     * ComponentArray manages components of type T for all entities.
-     * It provides efficient storage using unique_ptr for memory management
-     * and unordered_map for fast entity-to-component lookups.
+     * ComponentArray manages components of type T for all entities using a
+     * sparse set:
+     * - a dense, packed sequence of components, stored in fixed-size slabs,
+     * - a parallel dense vector holding the owning entity of each component,
+     * - a paged sparse index mapping an EntityID to its slot in the dense arrays.
+     *
+     * Lookups are two array reads, removal is swap-and-pop, and iterating the
+     * array is a linear scan over contiguous slabs. Slabs are never released
+     * before the array is destroyed, so create/destroy cycles reuse them
+     * without touching the heap, and growing the array never moves the
+     * components already stored.
+     *
+     * Components that cannot be moved (e.g. ones owning a mutex) are boxed:
+     * they are allocated from a per-type SlabPool, which keeps their address
+     * stable, and the dense sequence holds pointers to them.
+     *
+     * Iteration yields (EntityID, ComponentPtr<T>) pairs so existing loops of
+     * the form `for (auto& [entity, comp] : *array)` keep working. Iterators
+     * are index based: components added during iteration are visited, and the
+     * loop stays in bounds if components are removed while iterating.
      *
      * @tparam T The component type to store
      */
@@ -60,22 +226,185 @@ namespace ECS {
     class ComponentArray : public IComponentArray {
     private:
         /**
-         * @brief Storage for components mapped by entity ID
+         * @brief Whether T is stored by value in the dense vector
+         */
+        static constexpr bool IS_PACKED = std::is_move_constructible_v<T> && std::is_move_assignable_v<T>;
+
+        using Stored = std::conditional_t<IS_PACKED, T, T*>;
+
+        /**
+         * @brief Whether T is saved by snapshots (copied as raw bytes)
+         */
+        static constexpr bool IS_SNAPSHOTTABLE = std::is_trivially_copyable_v<T> && std::is_copy_constructible_v<T>;
+
+        /**
+         * @brief Packed component storage, parallel to m_set's dense entities
+         */
+        SlabVector<Stored> m_components;
+
+        /**
+         * @brief Storage of boxed components (unused when IS_PACKED)
+         */
+        SlabPool<T> m_boxes;
+
+        /**
+         * @brief Clock stamping modifications, null while change tracking is off
+         */
+        const std::atomic<Tick>* m_clock = nullptr;
+
+        /**
+         * @brief Last-modified tick of each dense slot, parallel to m_components
+         *
+         * Only maintained while change tracking is on.
+         */
+        std::vector<Tick> m_versions;
+
+        /**
+         * @brief Gets the current tick of the change-tracking clock
+         * @return Tick Current tick
+         */
+        Tick Now() const { return m_clock->load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Owning entities and entity -> slot index
+         */
+        SparseSet m_set;
+
+        /**
+         * @brief Gets the component stored in a dense slot
+         *
+         * @param slot The dense slot
+         * @return T& Reference to the component
+         */
+        T& At(std::size_t slot) {
+            if constexpr (IS_PACKED) {
+                return m_components[slot];
+            } else {
+                return *m_components[slot];
+            }
+        }
+
+        /**
+         * @brief Gets the component stored in a dense slot (const)
          *
-         * Uses unique_ptr for automatic memory management and to support
-         * polymorphic component types.
+         * @param slot The dense slot
+         * @return const T& Reference to the component
          */
-        std::unordered_map<EntityID, std::unique_ptr<T>> m_components;
+        const T& At(std::size_t slot) const {
+            if constexpr (IS_PACKED) {
+                return m_components[slot];
+            } else {
+                return *m_components[slot];
+            }
+        }
+
+        /**
+         * @brief Index-based iterator over (EntityID, ComponentPtr) pairs
+         *
+         * @tparam IsConst Whether the iterator yields const components
+         */
+        template<bool IsConst>
+        class Iterator {
+        private:
+            using Array = std::conditional_t<IsConst, const ComponentArray, ComponentArray>;
+            using Value = std::conditional_t<IsConst, const T, T>;
+
+            Array* m_array = nullptr;
+            std::size_t m_index = 0;
+            mutable std::pair<EntityID, ComponentPtr<Value>> m_current;
+
+            bool AtEnd() const {
+                return !m_array || m_index >= m_array->Size();
+            }
+
+        public:
+            using value_type = std::pair<EntityID, ComponentPtr<Value>>;
+            using reference = value_type&;
+            using pointer = value_type*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator() = default;
+
+            Iterator(Array* array, std::size_t index) : m_array(array), m_index(index) {}
+
+            reference operator*() const {
+                m_current.first = m_array->m_set.At(m_index);
+                m_current.second = ComponentPtr<Value>(&m_array->At(m_index));
+                return m_current;
+            }
+
+            pointer operator->() const { return &operator*(); }
+
+            Iterator& operator++() {
+                ++m_index;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++m_index;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const {
+                if (AtEnd() || other.AtEnd()) {
+                    return AtEnd() && other.AtEnd();
+                }
+                return m_index == other.m_index;
+            }
+
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+        };
 
     public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        ComponentArray() = default;
+
         /**
-         * @brief Adds a component to the specified entity
+         * @brief Destroys every component, boxed ones included
+         */
+        ~ComponentArray() override { Clear(); }
+
+        /**
+         * @brief Constructs a component for the specified entity in place
+         *
+         * If the entity already owns a component of this type, it is replaced.
          *
+         * @tparam Args The argument types for the component constructor
          * @param entity The EntityID to attach the component to
-         * @param component Unique pointer to the component instance
+         * @param args Arguments to forward to the component constructor
+         * @return T* Pointer to the stored component
          */
-        void AddComponent(EntityID entity, std::unique_ptr<T> component) {
-            m_components[entity] = std::move(component);
+        template<typename... Args>
+        T* AddComponent(EntityID entity, Args&&... args) {
+            std::uint32_t slot = m_set.IndexOf(entity);
+            if (slot != SparseSet::NO_SLOT) {
+                if constexpr (IS_PACKED) {
+                    m_components[slot] = T(std::forward<Args>(args)...);
+                } else {
+                    T* replacement = m_boxes.Allocate(std::forward<Args>(args)...);
+                    m_boxes.Free(m_components[slot]);
+                    m_components[slot] = replacement;
+                }
+                if (m_clock) {
+                    m_versions[slot] = Now();
+                }
+                return &At(slot);
+            }
+
+            if constexpr (IS_PACKED) {
+                m_components.EmplaceBack(std::forward<Args>(args)...);
+            } else {
+                m_components.EmplaceBack(m_boxes.Allocate(std::forward<Args>(args)...));
+            }
+            if (m_clock) {
+                m_versions.push_back(Now());
+            }
+            slot = m_set.Insert(entity);
+            return &At(slot);
         }
 
         /**
@@ -85,17 +414,66 @@ namespace ECS {
          * @return T* Pointer to the component, or nullptr if not found
          */
         T* GetComponent(EntityID entity) {
-            auto it = m_components.find(entity);
-            return (it != m_components.end()) ? it->second.get() : nullptr;
+            std::uint32_t slot = m_set.IndexOf(entity);
+            return (slot != SparseSet::NO_SLOT) ? &At(slot) : nullptr;
         }
 
         /**
          * @brief Removes a component from the specified entity
          *
+         * The last component of the array is moved into the freed slot so the
+         * storage stays packed.
+         *
          * @param entity The EntityID from which to remove the component
          */
         void RemoveComponent(EntityID entity) override {
-            m_components.erase(entity);
+            if (!m_set.Contains(entity)) {
+                return;
+            }
+
+            const std::uint32_t slot = m_set.Remove(entity);
+            if constexpr (!IS_PACKED) {
+                m_boxes.Free(m_components[slot]);
+            }
+            if (slot != m_components.Size() - 1) {
+                m_components[slot] = std::move(m_components.Back());
+                if (m_clock) {
+                    m_versions[slot] = m_versions.back();
+                }
+            }
+            m_components.PopBack();
+            if (m_clock) {
+                m_versions.pop_back();
+            }
+        }
+
+        /**
+         * @brief Gets the dense slot of an entity's component
+         *
+         * @param entity The EntityID to look up
+         * @return std::uint32_t The slot, or SparseSet::NO_SLOT if absent
+         */
+        std::uint32_t IndexOf(EntityID entity) const {
+            return m_set.IndexOf(entity);
+        }
+
+        /**
+         * @brief Swaps the components (and owners) stored in two dense slots
+         *
+         * Used by owning groups to keep their members packed at the front.
+         *
+         * @param a First dense slot
+         * @param b Second dense slot
+         */
+        void SwapSlots(std::size_t a, std::size_t b) {
+            if (a == b) {
+                return;
+            }
+            std::swap(m_components[a], m_components[b]);
+            if (m_clock) {
+                std::swap(m_versions[a], m_versions[b]);
+            }
+            m_set.Swap(a, b);
         }
 
         /**
@@ -105,39 +483,286 @@ namespace ECS {
          * @return true if the entity has this component, false otherwise
          */
         bool HasComponent(EntityID entity) const {
-            return m_components.find(entity) != m_components.end();
+            return m_set.Contains(entity);
         }
 
         /**
          * @brief Clears all components from this array
          */
         void Clear() override {
-            m_components.clear();
+            if constexpr (!IS_PACKED) {
+                for (std::size_t i = 0; i < m_components.Size(); ++i) {
+                    m_boxes.Free(m_components[i]);
+                }
+            }
+            m_components.Clear();
+            m_versions.clear();
+            m_set.Clear();
+        }
+
+        /**
+         * @brief Starts recording the tick at which each component last changed
+         *
+         * Components already stored count as changed now. Has no effect if
+         * tracking is already on.
+         *
+         * @param clock The clock to stamp modifications with, must outlive the array
+         */
+        void EnableChangeTracking(const std::atomic<Tick>* clock) {
+            if (m_clock) {
+                return;
+            }
+            m_clock = clock;
+            m_versions.assign(m_components.Size(), Now());
+        }
+
+        /**
+         * @brief Checks whether modifications are being recorded
+         * @return true if change tracking is on
+         */
+        bool IsTrackingChanges() const { return m_clock != nullptr; }
+
+        /**
+         * @brief Retrieves a component for writing, recording the modification
+         *
+         * Adding or replacing a component also counts as a modification;
+         * writes through GetComponent() or iteration are not seen.
+         *
+         * @param entity The EntityID to get the component from
+         * @return T* Pointer to the component, or nullptr if not found
+         */
+        T* Modify(EntityID entity) {
+            const std::uint32_t slot = m_set.IndexOf(entity);
+            if (slot == SparseSet::NO_SLOT) {
+                return nullptr;
+            }
+            if (m_clock) {
+                m_versions[slot] = Now();
+            }
+            return &At(slot);
+        }
+
+        /**
+         * @brief Records that an entity's component was modified
+         *
+         * @param entity The EntityID whose component changed
+         */
+        void MarkChanged(EntityID entity) {
+            Modify(entity);
+        }
+
+        /**
+         * @brief Gets the tick of the last modification of an entity's component
+         *
+         * @param entity The EntityID to look up
+         * @return Tick Last-modified tick, or 0 if absent or not tracked
+         */
+        Tick GetVersion(EntityID entity) const {
+            const std::uint32_t slot = m_set.IndexOf(entity);
+            return (m_clock && slot != SparseSet::NO_SLOT) ? m_versions[slot] : 0;
+        }
+
+        /**
+         * @brief Calls a function for every component modified at or after a tick
+         *
+         * Without change tracking every component is visited.
+         *
+         * @tparam Func Callable taking (EntityID, T&)
+         * @param since First tick of interest, typically the value World::AdvanceTick()
+         *        returned at the previous call
+         * @param func Function to call
+         */
+        template<typename Func>
+        void EachChangedSince(Tick since, Func&& func) {
+            for (std::size_t i = 0; i < m_components.Size(); ++i) {
+                if (!m_clock || m_versions[i] >= since) {
+                    func(m_set.At(i), At(i));
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the number of bytes one component takes in a snapshot
+         * @return std::size_t sizeof(T) if T is trivially copyable, 0 otherwise
+         */
+        std::size_t GetSnapshotSize() const override {
+            return IS_SNAPSHOTTABLE ? sizeof(T) : 0;
+        }
+
+        /**
+         * @brief Gets a hash of the component type name
+         * @return std::uint64_t Type name hash
+         */
+        std::uint64_t GetTypeHash() const override { return TypeNameHash<T>(); }
+
+        /**
+         * @brief Gets the name of the component type
+         * @return const char* typeid(T).name()
+         */
+        const char* GetTypeName() const override { return typeid(T).name(); }
+
+        /**
+         * @brief Gets the number of stored components
+         * @return std::size_t Component count
+         */
+        std::size_t GetComponentCount() const override { return m_components.Size(); }
+
+        /**
+         * @brief Copies every component and its owner, one memcpy per slab
+         *
+         * Does nothing for types that are left out of snapshots.
+         *
+         * @param entities Receives Size() entity handles
+         * @param bytes Receives Size() * sizeof(T) bytes
+         */
+        void CopyAll(EntityID* entities, unsigned char* bytes) const override {
+            if constexpr (IS_SNAPSHOTTABLE) {
+                std::memcpy(entities, m_set.Entities().data(), m_set.Size() * sizeof(EntityID));
+                if constexpr (IS_PACKED) {
+                    m_components.CopyTo(bytes);
+                } else {
+                    for (std::size_t i = 0; i < m_components.Size(); ++i) {
+                        std::memcpy(bytes + i * sizeof(T), &At(i), sizeof(T));
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Copies the component of one entity
+         *
+         * @param entity The EntityID whose component is copied
+         * @param bytes Receives sizeof(T) bytes
+         * @return true if the entity has the component (and T is snapshotted)
+         */
+        bool CopyComponent(EntityID entity, unsigned char* bytes) const override {
+            if constexpr (IS_SNAPSHOTTABLE) {
+                const std::uint32_t slot = m_set.IndexOf(entity);
+                if (slot != SparseSet::NO_SLOT) {
+                    std::memcpy(bytes, &At(slot), sizeof(T));
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Stores a component from its bytes, replacing the current one if any
+         *
+         * Stamps the component like Modify() when change tracking is on.
+         *
+         * @param entity The EntityID receiving the component
+         * @param bytes sizeof(T) bytes produced by CopyAll()/CopyComponent()
+         */
+        void AssignComponent(EntityID entity, const unsigned char* bytes) override {
+            if constexpr (IS_SNAPSHOTTABLE) {
+                if (T* component = Modify(entity)) {
+                    std::memcpy(static_cast<void*>(component), bytes, sizeof(T));
+                    return;
+                }
+                alignas(T) unsigned char copy[sizeof(T)];
+                std::memcpy(copy, bytes, sizeof(T));
+                AddComponent(entity, *std::launder(reinterpret_cast<T*>(copy)));
+            }
+        }
+
+        /**
+         * @brief Allocates storage for a number of components up front
+         *
+         * Useful before a burst of spawns so none of them allocates.
+         *
+         * @param capacity Number of components to make room for
+         */
+        void Reserve(std::size_t capacity) {
+            m_components.Reserve(capacity);
+            m_set.Reserve(capacity);
+        }
+
+        /**
+         * @brief Gets the number of components the allocated slabs can hold
+         * @return std::size_t Capacity
+         */
+        std::size_t Capacity() const { return m_components.Capacity(); }
+
+        /**
+         * @brief Gets the number of stored components
+         * @return std::size_t Component count
+         */
+        std::size_t Size() const { return m_components.Size(); }
+
+        /**
+         * @brief Checks whether the array holds no component
+         * @return true if empty, false otherwise
+         */
+        bool Empty() const { return m_components.Empty(); }
+
+        /**
+         * @brief Gets the component stored at a dense index
+         *
+         * @param index Dense index in [0, Size())
+         * @return T& Reference to the component
+         */
+        T& GetAt(std::size_t index) { return At(index); }
+
+        /**
+         * @brief Gets the address of a run of components stored side by side
+         *
+         * Only available for packed (movable) component types. The run
+         * length is given by RunAt(index).
+         *
+         * @param index Dense index in [0, Size())
+         * @return T* Address of the component at index; the next RunAt(index) - 1 follow it
+         */
+        T* DataAt(std::size_t index) {
+            static_assert(IS_PACKED, "ECS: boxed (non-movable) components are not stored contiguously");
+            return &m_components[index];
         }
 
+        /**
+         * @brief Gets the number of components stored contiguously from a dense index
+         *
+         * @param index Dense index in [0, Size())
+         * @return std::size_t Length of the run starting at index
+         */
+        std::size_t RunAt(std::size_t index) const { return m_components.RunFrom(index); }
+
+        /**
+         * @brief Gets the entity owning the component at a dense index
+         *
+         * @param index Dense index in [0, Size())
+         * @return EntityID The owning entity
+         */
+        EntityID GetEntityAt(std::size_t index) const { return m_set.At(index); }
+
+        /**
+         * @brief Gets the owning entities in dense order
+         * @return const std::vector<EntityID>& Dense entity list
+         */
+        const std::vector<EntityID>& Entities() const { return m_set.Entities(); }
+
         /**
          * @brief Returns iterator to the beginning of components
          * @return Iterator to the first component
          */
-        auto begin() { return m_components.begin(); }
+        iterator begin() { return iterator(this, 0); }
 
         /**
          * @brief Returns iterator to the end of components
          * @return Iterator past the last component
          */
-        auto end() { return m_components.end(); }
+        iterator end() { return iterator(this, Size()); }
 
         /**
          * @brief Returns const iterator to the beginning of components
          * @return Const iterator to the first component
          */
-        auto begin() const { return m_components.begin(); }
+        const_iterator begin() const { return const_iterator(this, 0); }
 
         /**
          * @brief Returns const iterator to the end of components
          * @return Const iterator past the last component
          */
-        auto end() const { return m_components.end(); }
+        const_iterator end() const { return const_iterator(this, Size()); }
     };
 
     /**
@@ -154,16 +779,137 @@ namespace ECS {
     class ComponentManager {
     private:
         /**
-         * @brief Storage for all component arrays, indexed by component type ID
+         * @brief All component arrays, indexed by component type ID
+         *
+         * A null entry means no component of that type was ever requested.
+         * Entries are atomic so systems running concurrently can look arrays
+         * up (and create missing ones) without a lock on the common path.
+         */
+        std::array<std::atomic<IComponentArray*>, MAX_COMPONENT_TYPES> m_componentArrays{};
+
+        /**
+         * @brief Ownership of the arrays referenced by m_componentArrays
+         */
+        std::vector<std::unique_ptr<IComponentArray>> m_arrayStorage;
+
+        /**
+         * @brief Serializes the creation of component arrays
+         */
+        std::mutex m_arrayCreationMutex;
+
+        /**
+         * @brief Creates an empty component array of one type
+         */
+        using ArrayFactory = std::unique_ptr<IComponentArray> (*)();
+
+        /**
+         * @brief Array factories of every component type used in the process, indexed by type ID
+         *
+         * Lets a snapshot be restored into a world that never touched some
+         * of its component types.
+         */
+        static inline std::array<std::atomic<ArrayFactory>, MAX_COMPONENT_TYPES> s_arrayFactories{};
+
+        /**
+         * @brief Type IDs of the types in s_arrayFactories, keyed by type name hash
+         *
+         * Type IDs follow registration order, which differs between processes;
+         * the hash does not, so snapshots name their types by hash.
+         */
+        static inline std::unordered_map<std::uint64_t, ComponentTypeID> s_typeIDsByHash;
+
+        /**
+         * @brief Guards s_typeIDsByHash
+         */
+        static inline std::mutex s_typeIDsByHashMutex;
+
+        /**
+         * @brief Component signature of each entity, indexed by entity slot index
+         *
+         * Bit N is set when the entity owns the component with type ID N. Used
+         * for O(1) HasComponent, signature matching and entity cleanup.
+         */
+        std::vector<Signature> m_signatures;
+
+        /**
+         * @brief Gets the signature slot of an entity, growing the table if needed
+         *
+         * @param entity The EntityID whose signature is requested
+         * @return Signature& Reference to the entity's signature
+         */
+        Signature& SignatureOf(EntityID entity) {
+            const std::uint32_t index = GetEntityIndex(entity);
+            if (index >= m_signatures.size()) {
+                m_signatures.resize(index + 1);
+            }
+            return m_signatures[index];
+        }
+
+        /**
+         * @brief Persistent groups, one per group type
+         */
+        std::unordered_map<std::type_index, std::unique_ptr<IComponentGroup>> m_groups;
+
+        /**
+         * @brief Groups to notify, indexed by component type ID
+         */
+        std::vector<std::vector<IComponentGroup*>> m_groupsByType;
+
+        /**
+         * @brief Component types whose pool is owned (reordered) by a group
+         */
+        Signature m_ownedTypes;
+
+        /**
+         * @brief Change-tracking clock shared by every tracked component array
+         */
+        std::atomic<Tick> m_tick{1};
+
+        /**
+         * @brief Lifecycle signals, indexed by component type ID
          */
-        std::unordered_map<ComponentTypeID, std::unique_ptr<IComponentArray>> m_componentArrays;
+        std::array<ComponentSignals, MAX_COMPONENT_TYPES> m_signals;
 
         /**
-         * @brief Mapping of entities to their component type IDs
+         * @brief Secondary indexes and partitions, one per (component type, key extractor) pair
          *
-         * Used for efficient cleanup and querying of entity components.
+         * Declared after m_signals so indexes disconnect before the signals go away.
          */
-        std::unordered_map<EntityID, std::vector<ComponentTypeID>> m_entityComponents;
+        std::unordered_map<std::type_index, std::unique_ptr<IComponentIndex>> m_indexes;
+
+        /**
+         * @brief Members of each tag type, indexed by component type ID
+         */
+        std::array<EntityBitset, MAX_COMPONENT_TYPES> m_tags;
+
+        /**
+         * @brief Handle of the entity owning each slot's tags, indexed by entity slot index
+         *
+         * Valid while at least one tag bit of the slot is set.
+         */
+        std::vector<EntityID> m_taggedHandles;
+
+        /**
+         * @brief Component types stored as tags rather than in a component array
+         */
+        Signature m_tagTypes;
+
+        /**
+         * @brief Notifies the groups of a component type that it was added to an entity
+         *
+         * @param typeID The component type that was added
+         * @param entity The EntityID that received it
+         * @return true if at least one group listens to this type
+         */
+        bool NotifyAdded(ComponentTypeID typeID, EntityID entity);
+
+        /**
+         * @brief Notifies the groups of a component type that it is about to be removed
+         *
+         * @param typeID The component type being removed
+         * @param entity The EntityID losing it
+         */
+        void NotifyRemoving(ComponentTypeID typeID, EntityID entity);
 
         /**
          * @brief Gets or creates a component array for the specified type
@@ -173,21 +919,32 @@ namespace ECS {
          */
         template<typename T>
         ComponentArray<T>* GetComponentArray() {
-            ComponentTypeID typeID = Component<T>::GetStaticTypeID();
-            auto it = m_componentArrays.find(typeID);
+            std::atomic<IComponentArray*>& slot = m_componentArrays[Component<T>::GetStaticTypeID()];
+            IComponentArray* array = slot.load(std::memory_order_acquire);
 
-            if (it == m_componentArrays.end()) {
-                m_componentArrays[typeID] = std::make_unique<ComponentArray<T>>();
+            if (!array) {
+                std::lock_guard<std::mutex> lock(m_arrayCreationMutex);
+                array = slot.load(std::memory_order_relaxed);
+                if (!array) {
+                    m_arrayStorage.push_back(std::make_unique<ComponentArray<T>>());
+                    array = m_arrayStorage.back().get();
+                    slot.store(array, std::memory_order_release);
+                    s_arrayFactories[Component<T>::GetStaticTypeID()].store(
+                        []() -> std::unique_ptr<IComponentArray> { return std::make_unique<ComponentArray<T>>(); },
+                        std::memory_order_release);
+                    std::lock_guard<std::mutex> hashLock(s_typeIDsByHashMutex);
+                    s_typeIDsByHash.emplace(TypeNameHash<T>(), Component<T>::GetStaticTypeID());
+                }
             }
 
-            return static_cast<ComponentArray<T>*>(m_componentArrays[typeID].get());
+            return static_cast<ComponentArray<T>*>(array);
         }
 
     public:
         /**
-         * @brief Default constructor
+         * @brief Constructs an empty manager with one table slot per possible component type
          */
-        ComponentManager() = default;
+        ComponentManager() : m_groupsByType(MAX_COMPONENT_TYPES) {}
 
         /**
          * @brief Default destructor
@@ -198,7 +955,9 @@ namespace ECS {
          * @brief Creates and adds a component to an entity
          *
          * Creates a new component of type T with the provided arguments
-         * and attaches it to the specified entity.
+         * and attaches it to the specified entity. Groups observing T are
+         * updated before returning, then OnConstruct<T> fires (OnUpdate<T>
+         * if the entity already had a T, which is replaced).
          *
          * @tparam T The component type to create
          * @tparam Args The argument types for the component constructor
@@ -208,15 +967,22 @@ namespace ECS {
          */
         template<typename T, typename... Args>
         T* AddComponent(EntityID entity, Args&&... args) {
-            auto component = std::make_unique<T>(std::forward<Args>(args)...);
-            T* componentPtr = component.get();
-
-            GetComponentArray<T>()->AddComponent(entity, std::move(component));
-
-            ComponentTypeID typeID = Component<T>::GetStaticTypeID();
-            m_entityComponents[entity].push_back(typeID);
+            const ComponentTypeID typeID = Component<T>::GetStaticTypeID();
+            ComponentArray<T>* array = GetComponentArray<T>();
+            Signature& signature = SignatureOf(entity);
+            const bool replacing = signature.test(typeID);
+            signature.set(typeID);
+            T* component = array->AddComponent(entity, std::forward<Args>(args)...);
+            if (NotifyAdded(typeID, entity)) {
+                // An owning group may have moved the component to its packed range
+                component = array->GetComponent(entity);
+            }
 
-            return componentPtr;
+            Signal& signal = replacing ? m_signals[typeID].update : m_signals[typeID].construct;
+            if (!signal.Empty()) {
+                signal.Emit(entity);
+            }
+            return component;
         }
 
         /**
@@ -231,6 +997,97 @@ namespace ECS {
             return GetComponentArray<T>()->GetComponent(entity);
         }
 
+        /**
+         * @brief Retrieves a component for writing, recording the modification
+         *
+         * Stamps the component when T is change-tracked and fires
+         * OnUpdate<T>. Listeners run before the caller writes.
+         *
+         * @tparam T The component type to retrieve
+         * @param entity The EntityID to get the component from
+         * @return T* Pointer to the component, or nullptr if not found
+         */
+        template<typename T>
+        T* ModifyComponent(EntityID entity) {
+            T* component = GetComponentArray<T>()->Modify(entity);
+            Signal& signal = m_signals[Component<T>::GetStaticTypeID()].update;
+            if (component && !signal.Empty()) {
+                signal.Emit(entity);
+            }
+            return component;
+        }
+
+        /**
+         * @brief Gets the signal fired when a component of type T is added to an entity
+         *
+         * @tparam T The component type
+         * @return Signal& The signal
+         */
+        template<typename T>
+        Signal& OnConstruct() {
+            return m_signals[Component<T>::GetStaticTypeID()].construct;
+        }
+
+        /**
+         * @brief Gets the signal fired when a component of type T is replaced or modified
+         *
+         * @tparam T The component type
+         * @return Signal& The signal
+         */
+        template<typename T>
+        Signal& OnUpdate() {
+            return m_signals[Component<T>::GetStaticTypeID()].update;
+        }
+
+        /**
+         * @brief Gets the signal fired right before a component of type T is removed
+         *
+         * @tparam T The component type
+         * @return Signal& The signal
+         */
+        template<typename T>
+        Signal& OnDestroy() {
+            return m_signals[Component<T>::GetStaticTypeID()].destroy;
+        }
+
+        /**
+         * @brief Delivers the events recorded for queued listeners of every signal
+         *
+         * Then brings every partition up to date.
+         */
+        void DispatchQueuedEvents();
+
+        /**
+         * @brief Gets the number of stored components of every type used so far
+         *
+         * Type names are demangled where the compiler allows it.
+         *
+         * @return std::vector<ComponentCount> One entry per component array, in type ID order
+         */
+        std::vector<ComponentCount> GetComponentCounts() const;
+
+        /**
+         * @brief Starts change tracking for a component type
+         *
+         * @tparam T The component type to track
+         */
+        template<typename T>
+        void EnableChangeTracking() {
+            GetComponentArray<T>()->EnableChangeTracking(&m_tick);
+        }
+
+        /**
+         * @brief Gets the current change-tracking tick
+         * @return Tick Current tick
+         */
+        Tick GetTick() const { return m_tick.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Moves the change-tracking clock forward
+         * @return Tick The new tick
+         */
+        Tick AdvanceTick() { return m_tick.fetch_add(1, std::memory_order_relaxed) + 1; }
+
         /**
          * @brief Removes a component from an entity
          *
@@ -239,39 +1096,205 @@ namespace ECS {
          */
         template<typename T>
         void RemoveComponent(EntityID entity) {
-            GetComponentArray<T>()->RemoveComponent(entity);
+            ComponentArray<T>* array = GetComponentArray<T>();
+            if (!array->HasComponent(entity)) {
+                return;
+            }
+
+            const ComponentTypeID typeID = Component<T>::GetStaticTypeID();
+            Signal& signal = m_signals[typeID].destroy;
+            if (!signal.Empty()) {
+                signal.Emit(entity);
+            }
+            NotifyRemoving(typeID, entity);
+            array->RemoveComponent(entity);
+            SignatureOf(entity).reset(typeID);
+        }
+
+        /**
+         * @brief Adds a tag to an entity
+         *
+         * Sets one signature bit and one bit in the tag's bitset; nothing
+         * is allocated per entity. OnConstruct<T> fires if the entity did
+         * not have the tag.
+         *
+         * @tparam T An empty tag type
+         * @param entity The EntityID to tag
+         */
+        template<typename T>
+        void AddTag(EntityID entity) {
+            static_assert(IS_TAG_COMPONENT<T>, "ECS: tags must be empty types");
+            const ComponentTypeID typeID = Component<T>::GetStaticTypeID();
+            Signature& signature = SignatureOf(entity);
+            if (signature.test(typeID)) {
+                return;
+            }
+            signature.set(typeID);
+            m_tagTypes.set(typeID);
+
+            const std::uint32_t index = GetEntityIndex(entity);
+            if (index >= m_taggedHandles.size()) {
+                m_taggedHandles.resize(index + 1, INVALID_ENTITY);
+            }
+            m_taggedHandles[index] = entity;
+            m_tags[typeID].Set(index);
+
+            Signal& signal = m_signals[typeID].construct;
+            if (!signal.Empty()) {
+                signal.Emit(entity);
+            }
+        }
+
+        /**
+         * @brief Removes a tag from an entity, firing OnDestroy<T> if it had it
+         *
+         * @tparam T An empty tag type
+         * @param entity The EntityID to untag
+         */
+        template<typename T>
+        void RemoveTag(EntityID entity) {
+            static_assert(IS_TAG_COMPONENT<T>, "ECS: tags must be empty types");
+            const ComponentTypeID typeID = Component<T>::GetStaticTypeID();
+            if (!GetSignature(entity).test(typeID)) {
+                return;
+            }
+
+            Signal& signal = m_signals[typeID].destroy;
+            if (!signal.Empty()) {
+                signal.Emit(entity);
+            }
+            m_tags[typeID].Reset(GetEntityIndex(entity));
+            SignatureOf(entity).reset(typeID);
+        }
+
+        /**
+         * @brief Calls a function for every entity carrying a tag, in slot order
+         *
+         * A scan of the tag's bitset. The function may remove the tag or
+         * destroy the entity it is given.
+         *
+         * @tparam T An empty tag type
+         * @tparam Func Callable taking an EntityID
+         * @param func Function to call
+         */
+        template<typename T, typename Func>
+        void EachTagged(Func&& func) {
+            static_assert(IS_TAG_COMPONENT<T>, "ECS: tags must be empty types");
+            m_tags[Component<T>::GetStaticTypeID()].ForEach([this, &func](std::uint32_t index) {
+                func(m_taggedHandles[index]);
+            });
+        }
 
-            ComponentTypeID typeID = Component<T>::GetStaticTypeID();
-            auto& components = m_entityComponents[entity];
-            components.erase(std::remove(components.begin(), components.end(), typeID), components.end());
+        /**
+         * @brief Gets the number of entities carrying a tag
+         *
+         * @tparam T An empty tag type
+         * @return std::size_t Tagged entity count
+         */
+        template<typename T>
+        std::size_t GetTagCount() const {
+            return m_tags[Component<T>::GetStaticTypeID()].Count();
         }
 
         /**
          * @brief Checks if an entity has a specific component type
          *
+         * A single bit test on the entity's signature. The handle must be
+         * alive; World::HasComponent checks that first.
+         *
          * @tparam T The component type to check for
          * @param entity The EntityID to check
          * @return true if the entity has the component, false otherwise
          */
         template<typename T>
         bool HasComponent(EntityID entity) const {
-            ComponentTypeID typeID = Component<T>::GetStaticTypeID();
-            auto it = m_componentArrays.find(typeID);
-            if (it == m_componentArrays.end()) {
-                return false;
-            }
-            return static_cast<const ComponentArray<T>*>(it->second.get())->HasComponent(entity);
+            return GetSignature(entity).test(Component<T>::GetStaticTypeID());
+        }
+
+        /**
+         * @brief Gets the component signature of an entity
+         *
+         * @param entity The EntityID to query (must be alive)
+         * @return Signature The set of component types the entity owns
+         */
+        Signature GetSignature(EntityID entity) const {
+            const std::uint32_t index = GetEntityIndex(entity);
+            return index < m_signatures.size() ? m_signatures[index] : Signature();
+        }
+
+        /**
+         * @brief Checks whether an entity owns every component of a signature
+         *
+         * @param entity The EntityID to test (must be alive)
+         * @param required The required component types
+         * @return true if (signature & required) == required
+         */
+        bool Matches(EntityID entity, const Signature& required) const {
+            return (GetSignature(entity) & required) == required;
+        }
+
+        /**
+         * @brief Gets the component array of a type ID if this manager created it
+         *
+         * @param typeID The component type ID
+         * @return IComponentArray* The array, or nullptr if no component of that type was ever requested
+         */
+        IComponentArray* FindComponentArray(ComponentTypeID typeID) const {
+            return m_componentArrays[typeID].load(std::memory_order_acquire);
         }
 
+        /**
+         * @brief Gets the component array of a type ID, creating it if needed
+         *
+         * Type-erased counterpart of GetAllComponents<T>(), used by snapshots.
+         *
+         * @param typeID The component type ID
+         * @return IComponentArray* The array, or nullptr if the type was never used in this process
+         */
+        IComponentArray* GetComponentArray(ComponentTypeID typeID);
+
+        /**
+         * @brief Gets the type ID of a component type in this process from its type name hash
+         *
+         * @param hash TypeNameHash<T>() of the component type
+         * @return ComponentTypeID The type ID, or MAX_COMPONENT_TYPES if the type was never used in this process
+         */
+        static ComponentTypeID FindTypeID(std::uint64_t hash);
+
+        /**
+         * @brief Stores a component from its snapshot bytes, adding or replacing it
+         *
+         * Same bookkeeping as AddComponent(): signature, groups, then
+         * OnConstruct (or OnUpdate when replacing).
+         *
+         * @param typeID The component type ID
+         * @param entity The EntityID receiving the component
+         * @param bytes The component bytes, GetSnapshotSize() of them
+         */
+        void AssignComponent(ComponentTypeID typeID, EntityID entity, const unsigned char* bytes);
+
+        /**
+         * @brief Removes a component given its type ID
+         *
+         * @param typeID The component type ID
+         * @param entity The EntityID to remove the component from
+         */
+        void RemoveComponent(ComponentTypeID typeID, EntityID entity);
+
         /**
          * @brief Removes all components from the specified entity
          *
+         * OnDestroy fires for each component first, while every component
+         * of the entity is still readable.
+         *
          * @param entity The EntityID to remove all components from
          */
         void RemoveAllComponents(EntityID entity);
 
         /**
          * @brief Clears all components from all entities
+         *
+         * No signal fires; undelivered queued events are dropped.
          */
         void Clear();
 
@@ -288,6 +1311,100 @@ namespace ECS {
         ComponentArray<T>* GetAllComponents() {
             return GetComponentArray<T>();
         }
+
+        /**
+         * @brief Gets or creates the persistent group for a component signature
+         *
+         * The group is built from the current storage on first use and then
+         * maintained incrementally by AddComponent/RemoveComponent, so later
+         * calls are a single hash lookup.
+         *
+         * @tparam Os Component types owned by the group (may be empty)
+         * @tparam Ws Component types observed by the group
+         * @return ComponentGroup<With<Ws...>, Os...>& The group
+         * @throws std::runtime_error if one of Os is already owned by another group
+         */
+        template<typename... Os, typename... Ws>
+        ComponentGroup<With<Ws...>, Os...>& GetGroup(With<Ws...>) {
+            using GroupType = ComponentGroup<With<Ws...>, Os...>;
+            const std::type_index key(typeid(GroupType));
+
+            auto it = m_groups.find(key);
+            if (it != m_groups.end()) {
+                return static_cast<GroupType&>(*it->second);
+            }
+
+            if ((m_ownedTypes & MakeSignature<Os...>()).any()) {
+                throw std::runtime_error("ECS: component type already owned by another group");
+            }
+
+            auto group = std::make_unique<GroupType>(std::make_tuple(GetComponentArray<Os>()...),
+                                                     std::make_tuple(GetComponentArray<Ws>()...));
+            GroupType& ref = *group;
+            m_ownedTypes |= MakeSignature<Os...>();
+            (m_groupsByType[Component<Os>::GetStaticTypeID()].push_back(&ref), ...);
+            (m_groupsByType[Component<Ws>::GetStaticTypeID()].push_back(&ref), ...);
+            m_groups.emplace(key, std::move(group));
+
+            ref.Rebuild();
+            return ref;
+        }
+
+        /**
+         * @brief Gets or creates the secondary index of T keyed by KeyOf
+         *
+         * The index is built from the current storage on first use and then
+         * maintained through the signals of T. Creation connects listeners,
+         * so create indexes where no system is running (e.g. at startup).
+         *
+         * @tparam T The indexed component type
+         * @tparam KeyOf Callable returning the key of a const T&
+         * @return ComponentIndex<T, KeyOf>& The index
+         */
+        template<typename T, typename KeyOf>
+        ComponentIndex<T, KeyOf>& GetIndex() {
+            using IndexType = ComponentIndex<T, KeyOf>;
+            const std::type_index key(typeid(IndexType));
+
+            auto it = m_indexes.find(key);
+            if (it != m_indexes.end()) {
+                return static_cast<IndexType&>(*it->second);
+            }
+
+            auto index = std::make_unique<IndexType>(GetComponentArray<T>(), m_signals[Component<T>::GetStaticTypeID()]);
+            IndexType& ref = *index;
+            m_indexes.emplace(key, std::move(index));
+
+            ref.Rebuild();
+            return ref;
+        }
+
+        /**
+         * @brief Gets or creates the partition of T by the category KeyOf returns
+         *
+         * Same lifetime and creation rules as GetIndex().
+         *
+         * @tparam T The partitioned component type
+         * @tparam KeyOf Callable returning the category (enum or integer) of a const T&
+         * @return ComponentPartition<T, KeyOf>& The partition
+         */
+        template<typename T, typename KeyOf>
+        ComponentPartition<T, KeyOf>& GetPartition() {
+            using PartitionType = ComponentPartition<T, KeyOf>;
+            const std::type_index key(typeid(PartitionType));
+
+            auto it = m_indexes.find(key);
+            if (it != m_indexes.end()) {
+                return static_cast<PartitionType&>(*it->second);
+            }
+
+            auto partition = std::make_unique<PartitionType>(GetComponentArray<T>(), m_signals[Component<T>::GetStaticTypeID()]);
+            PartitionType& ref = *partition;
+            m_indexes.emplace(key, std::move(partition));
+
+            ref.Rebuild();
+            return ref;
+        }
     };
 }
 
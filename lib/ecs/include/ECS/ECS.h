@@ -36,6 +36,18 @@
 #include "ComponentManager.h"
 #include "System.h"
 #include "SystemManager.h"
+#include "CommandBuffer.h"
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include "Signal.h"
+#include "Index.h"
+#include "Tag.h"
+#include "Partition.h"
+#include "Snapshot.h"
+#include "Prefab.h"
+#include "Hierarchy.h"
+#include "Group.h"
+#include "View.h"
 #include "World.h"
 
 /**
@@ -13,6 +13,8 @@
 #define ECS_ENTITYMANAGER_HPP
 
 #include "Types.h"
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <queue>
 
@@ -21,46 +23,56 @@ namespace ECS {
      * @brief Manages entity creation, destruction, and lifecycle
      *
      * The EntityManager is responsible for:
-     * - Creating new entities with unique IDs
-     * - Destroying entities and marking them as inactive
-     * - Recycling entity IDs for efficient memory usage
-     * - Tracking which entities are alive/active
+     * - Creating new entities as generational handles (see EntityID)
+     * - Destroying entities and invalidating every handle to them
+     * - Recycling slot indices for efficient memory usage
+     * - Keeping a packed list of alive entities
      *
-     * Entity IDs are reused when entities are destroyed to prevent
-     * ID exhaustion and maintain performance.
+     * Slot indices are reused in FIFO order when entities are destroyed, and
+     * the slot generation is bumped each time, so validity checks are a
+     * single comparison against the slot's current handle.
      */
     class EntityManager {
     private:
         /**
-         * @brief Tracks which entities are currently alive
-         *
-         * Uses a vector<bool> for memory-efficient storage of entity states.
-         * Index corresponds to EntityID, value indicates if entity is alive.
+         * @brief Index value meaning "slot is not alive"
+         */
+        static constexpr std::uint32_t NOT_ALIVE = 0xFFFFFFFFu;
+
+        /**
+         * @brief Per-index bookkeeping
          */
-        std::vector<bool> m_aliveEntities;
+        struct Slot {
+            EntityID handle;        ///< Current handle of the slot (index + generation)
+            std::uint32_t alive;    ///< Position in m_alive, or NOT_ALIVE
+        };
 
         /**
-         * @brief Queue of entity IDs available for reuse
+         * @brief Slots indexed by entity index; slot 0 is reserved for INVALID_ENTITY
+         */
+        std::vector<Slot> m_slots;
+
+        /**
+         * @brief Packed list of alive entity handles
          *
-         * When entities are destroyed, their IDs are added to this queue
-         * for reuse when creating new entities.
+         * Destruction is swap-and-pop, so this list is unordered.
          */
-        std::queue<EntityID> m_freeEntities;
+        std::vector<EntityID> m_alive;
 
         /**
-         * @brief Next available entity ID for new entities
+         * @brief Queue of slot indices available for reuse
          *
-         * Used when no free entity IDs are available for reuse.
-         * Incremented each time a new ID is needed.
+         * FIFO reuse spreads generation bumps over all free slots, which
+         * delays generation wrap-around on any single slot.
          */
-        EntityID m_nextEntityID;
+        std::queue<std::uint32_t> m_freeIndices;
 
     public:
         /**
          * @brief Constructs a new EntityManager
          *
          * Initializes the entity manager with default values.
-         * Sets the next entity ID to 1 (since 0 is reserved for INVALID_ENTITY).
+         * Reserves slot 0 so that INVALID_ENTITY is never handed out.
          */
         EntityManager();
 
@@ -73,19 +85,33 @@ namespace ECS {
          * @brief Creates a new entity and returns its ID
          *
          * Creates a new entity by either:
-         * 1. Reusing a previously freed entity ID, or
-         * 2. Assigning the next available ID
+         * 1. Reusing a previously freed slot with its bumped generation, or
+         * 2. Appending a new slot
          *
-         * @return EntityID The unique identifier for the newly created entity
+         * @return EntityID The handle of the newly created entity
+         * @throws std::runtime_error if all 2^ENTITY_INDEX_BITS slots are alive
          */
         EntityID CreateEntity();
 
+        /**
+         * @brief Creates a batch of entities
+         *
+         * Same slot reuse as CreateEntity(), with the bookkeeping tables
+         * grown once for the whole batch.
+         *
+         * @param count Number of entities to create
+         * @return std::vector<EntityID> The new handles, in creation order
+         * @throws std::runtime_error if the index space runs out
+         */
+        std::vector<EntityID> CreateEntities(std::size_t count);
+
         /**
          * @brief Destroys an entity and marks it as inactive
          *
-         * Marks the entity as destroyed and adds its ID to the free queue
-         * for potential reuse. The entity's components should be cleaned up
-         * separately by the ComponentManager.
+         * Removes the entity from the alive list, bumps the slot generation
+         * (invalidating every copy of the handle) and queues the slot for
+         * reuse. The entity's components should be cleaned up separately by
+         * the ComponentManager. Stale or invalid handles are ignored.
          *
          * @param entity The EntityID of the entity to destroy
          */
@@ -94,16 +120,22 @@ namespace ECS {
         /**
          * @brief Checks if an entity is currently alive/active
          *
+         * O(1): compares the handle with the current handle of its slot.
+         *
          * @param entity The EntityID to check
          * @return true if the entity exists and is alive, false otherwise
          */
-        bool IsEntityAlive(EntityID entity) const;
+        bool IsEntityAlive(EntityID entity) const {
+            const std::uint32_t index = GetEntityIndex(entity);
+            return index != 0 && index < m_slots.size()
+                && m_slots[index].handle == entity && m_slots[index].alive != NOT_ALIVE;
+        }
 
         /**
          * @brief Clears all entities and resets the manager
          *
-         * Destroys all entities, clears internal data structures,
-         * and resets the manager to its initial state.
+         * Destroys all entities and frees every slot. Slot generations are
+         * kept, so handles issued before the call remain invalid.
          */
         void Clear();
 
@@ -112,13 +144,17 @@ namespace ECS {
          *
          * @return size_t The count of entities that are currently active
          */
-        size_t GetAliveEntityCount() const;
+        size_t GetAliveEntityCount() const { return m_alive.size(); }
 
         /**
-         * @brief Get a vector of all currently alive entities.
-         * @return Vector of EntityID representing all alive entities.
+         * @brief Get the packed list of all currently alive entities.
+         *
+         * The list is unordered and is modified by CreateEntity/DestroyEntity;
+         * copy it first if entities are created or destroyed while iterating.
+         *
+         * @return Reference to the alive entity handles.
          */
-        std::vector<std::uint32_t> GetAllEntities() const;
+        const std::vector<EntityID>& GetAllEntities() const { return m_alive; }
     };
 }
 
@@ -0,0 +1,351 @@
+/**
+ * @file Group.h
+ * @brief Persistent, incrementally maintained component groups
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the ComponentGroup class. A group is created once per
+ * component signature and then kept up to date by the ComponentManager on
+ * every AddComponent/RemoveComponent, so iterating it each tick only touches
+ * entities that are known to match.
+ */
+
+#ifndef ECS_GROUP_HPP
+#define ECS_GROUP_HPP
+
+#include "Types.h"
+#include "SparseSet.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace ECS {
+    template<typename T>
+    class ComponentArray;
+
+    /**
+     * @brief Tag listing component types a group requires but does not own
+     *
+     * @tparam Ts The observed component types
+     *
+     * @example
+     * world.Group<>(ECS::With<Player, Position, Health>{})   // non-owning
+     * world.Group<Position, Velocity>()                      // owning
+     */
+    template<typename... Ts>
+    struct With {};
+
+    /**
+     * @brief Type-erased interface the ComponentManager uses to keep groups in sync
+     */
+    class IComponentGroup {
+    public:
+        /**
+         * @brief Virtual destructor for proper cleanup
+         */
+        virtual ~IComponentGroup() = default;
+
+        /**
+         * @brief Called after one of the group's component types was added to an entity
+         *
+         * @param entity The EntityID that received the component
+         */
+        virtual void OnComponentAdded(EntityID entity) = 0;
+
+        /**
+         * @brief Called before one of the group's component types is removed from an entity
+         *
+         * @param entity The EntityID losing the component
+         */
+        virtual void OnComponentRemoving(EntityID entity) = 0;
+
+        /**
+         * @brief Recomputes membership from scratch
+         *
+         * Used when the group is created and after the component storage was cleared.
+         */
+        virtual void Rebuild() = 0;
+    };
+
+    /**
+     * @brief Primary template, only the With<> specialization is defined
+     */
+    template<typename Observed, typename... Owned>
+    class ComponentGroup;
+
+    /**
+     * @brief Entities owning all of Owned... and Observed..., maintained incrementally
+     *
+     * Two flavours exist, selected by whether Owned is empty:
+     * - **Owning group** (Owned non-empty): the group takes ownership of the
+     *   Owned pools and keeps its members packed in slots [0, Size()) of each
+     *   of them, in the same order. Iteration is a linear walk over parallel
+     *   arrays, no lookup at all for owned components. A component type can be
+     *   owned by at most one group.
+     *   Owning groups double as archetype storage: see EachChunk().
+ * - **Non-owning group** (Owned empty): the group keeps its own packed list
+     *   of member entities and fetches components through the sparse index.
+     *
+     * Iteration runs from the last member to the first, so destroying the
+     * current entity (or removing one of its grouped components) inside Each()
+     * never skips a member.
+     *
+     * @tparam Ws Observed (non-owned) component types
+     * @tparam Os Owned component types
+     */
+    template<typename... Ws, typename... Os>
+    class ComponentGroup<With<Ws...>, Os...> : public IComponentGroup {
+        static_assert(sizeof...(Os) + sizeof...(Ws) > 0, "A group needs at least one component type");
+
+    private:
+        /**
+         * @brief Whether the group packs its members inside the owned pools
+         */
+        static constexpr bool IS_OWNING = sizeof...(Os) > 0;
+
+        /**
+         * @brief Pools owned (and reordered) by the group
+         */
+        std::tuple<ComponentArray<Os>*...> m_owned;
+
+        /**
+         * @brief Pools the group only observes
+         */
+        std::tuple<ComponentArray<Ws>*...> m_observed;
+
+        /**
+         * @brief Number of members packed at the front of the owned pools
+         */
+        std::size_t m_length = 0;
+
+        /**
+         * @brief Member entities of a non-owning group
+         */
+        SparseSet m_members;
+
+        /**
+         * @brief Gets the first owned pool, the reference for member order
+         * @return Pointer to the first owned pool
+         */
+        auto* Lead() const {
+            return std::get<0>(m_owned);
+        }
+
+        /**
+         * @brief Checks whether an entity owns every grouped component type
+         *
+         * @param entity The EntityID to test
+         * @return true if the entity matches the group signature
+         */
+        bool Matches(EntityID entity) const {
+            return std::apply([entity](auto*... pools) { return (pools->HasComponent(entity) && ...); }, m_owned)
+                && std::apply([entity](auto*... pools) { return (pools->HasComponent(entity) && ...); }, m_observed);
+        }
+
+        /**
+         * @brief Inserts a matching entity that is not a member yet
+         *
+         * @param entity The EntityID to insert
+         */
+        void Insert(EntityID entity) {
+            if constexpr (IS_OWNING) {
+                std::apply([this, entity](auto*... pools) {
+                    (pools->SwapSlots(pools->IndexOf(entity), m_length), ...);
+                }, m_owned);
+                ++m_length;
+            } else {
+                m_members.Insert(entity);
+            }
+        }
+
+        /**
+         * @brief Calls a function with an entity and all of its grouped components
+         *
+         * @param func Function to call
+         * @param index Member index (dense slot of owned pools for owning groups)
+         * @param entity The member entity
+         */
+        template<typename Func>
+        void Invoke(Func& func, [[maybe_unused]] std::size_t index, EntityID entity) const {
+            if constexpr (std::is_invocable_v<Func&, EntityID, Os&..., Ws&...>) {
+                func(entity, std::get<ComponentArray<Os>*>(m_owned)->GetAt(index)...,
+                     *std::get<ComponentArray<Ws>*>(m_observed)->GetComponent(entity)...);
+            } else {
+                func(std::get<ComponentArray<Os>*>(m_owned)->GetAt(index)...,
+                     *std::get<ComponentArray<Ws>*>(m_observed)->GetComponent(entity)...);
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructs a group over the given pools
+         *
+         * Membership is empty until Rebuild() is called.
+         *
+         * @param owned The owned component pools
+         * @param observed The observed component pools
+         */
+        ComponentGroup(std::tuple<ComponentArray<Os>*...> owned, std::tuple<ComponentArray<Ws>*...> observed)
+            : m_owned(owned), m_observed(observed) {}
+
+        /**
+         * @brief Checks whether an entity is a member of the group
+         *
+         * @param entity The EntityID to check
+         * @return true if the entity is a member, false otherwise
+         */
+        bool Contains(EntityID entity) const {
+            if constexpr (IS_OWNING) {
+                return Lead()->IndexOf(entity) < m_length;
+            } else {
+                return m_members.Contains(entity);
+            }
+        }
+
+        /**
+         * @brief Gets the number of members
+         * @return std::size_t Member count
+         */
+        std::size_t Size() const {
+            if constexpr (IS_OWNING) {
+                return m_length;
+            } else {
+                return m_members.Size();
+            }
+        }
+
+        /**
+         * @brief Calls a function for every member
+         *
+         * The function may take either (EntityID, Os&..., Ws&...) or
+         * (Os&..., Ws&...).
+         *
+         * @tparam Func Callable type
+         * @param func Function to call
+         */
+        template<typename Func>
+        void Each(Func&& func) const {
+            for (std::size_t i = Size(); i-- > 0;) {
+                if (i >= Size()) {
+                    continue;
+                }
+                if constexpr (IS_OWNING) {
+                    Invoke(func, i, Lead()->GetEntityAt(i));
+                } else {
+                    Invoke(func, i, m_members.At(i));
+                }
+            }
+        }
+
+        /**
+         * @brief Calls a function for every member, from several threads
+         *
+         * Splits the members into chunks of grainSize processed on the given
+         * pool. Each member is visited exactly once, on an unspecified
+         * thread. The function must not make structural changes (record
+         * them in the calling thread's world.GetCommandBuffer()) nor write
+         * components of other entities.
+         *
+         * @tparam Func Callable type, taking (EntityID, Os&..., Ws&...) or (Os&..., Ws&...)
+         * @param pool The pool running the chunks
+         * @param func Function to call, concurrently
+         * @param grainSize Maximum number of members per chunk
+         */
+        template<typename Func>
+        void ParallelEach(ThreadPool& pool, Func&& func, std::size_t grainSize = ThreadPool::DEFAULT_GRAIN_SIZE) const {
+            pool.ParallelFor(Size(), grainSize, [this, &func](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    if constexpr (IS_OWNING) {
+                        Invoke(func, i, Lead()->GetEntityAt(i));
+                    } else {
+                        Invoke(func, i, m_members.At(i));
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Calls a function for every chunk of members, one column per owned type
+         *
+         * Members of an owning group sit in the same slots of every owned
+         * pool, and pools store components in fixed-size slabs, so the group
+         * is a sequence of chunks in which each owned type is a plain array.
+         * A chunk ends at the first slab boundary of any owned pool. The
+         * function receives the chunk length, the member entities and one
+         * pointer per owned type, and can run tight loops over the columns it
+         * needs without touching the others.
+         *
+         * Only for owning groups without observed types, whose owned types
+         * are movable. The function must not make structural changes (record
+         * them in world.GetCommandBuffer()).
+         *
+         * @tparam Func Callable taking (std::size_t count, const EntityID* entities, Os*... columns)
+         * @param func Function to call once per chunk
+         *
+         * @example
+         * world.Archetype<Position, Velocity>().EachChunk([dt](std::size_t n, const ECS::EntityID*, Position* pos, Velocity* vel) {
+         *     for (std::size_t i = 0; i < n; ++i) { pos[i].x += vel[i].vx * dt; }
+         * });
+         */
+        template<typename Func>
+        void EachChunk(Func&& func) const {
+            static_assert(IS_OWNING && sizeof...(Ws) == 0, "ECS: chunks are only available on owning groups without observed types");
+            const EntityID* entities = Lead()->Entities().data();
+            for (std::size_t begin = 0; begin < m_length;) {
+                std::size_t count = m_length - begin;
+                std::apply([begin, &count](auto*... pools) {
+                    ((count = std::min(count, pools->RunAt(begin))), ...);
+                }, m_owned);
+                func(count, entities + begin, std::get<ComponentArray<Os>*>(m_owned)->DataAt(begin)...);
+                begin += count;
+            }
+        }
+
+        void OnComponentAdded(EntityID entity) override {
+            if (!Contains(entity) && Matches(entity)) {
+                Insert(entity);
+            }
+        }
+
+        void OnComponentRemoving(EntityID entity) override {
+            if (!Contains(entity)) {
+                return;
+            }
+            if constexpr (IS_OWNING) {
+                --m_length;
+                std::apply([this, entity](auto*... pools) {
+                    (pools->SwapSlots(pools->IndexOf(entity), m_length), ...);
+                }, m_owned);
+            } else {
+                m_members.Remove(entity);
+            }
+        }
+
+        void Rebuild() override {
+            m_length = 0;
+            m_members.Clear();
+
+            const std::vector<EntityID>* smallest = nullptr;
+            auto pick = [&smallest](const std::vector<EntityID>& entities) {
+                if (!smallest || entities.size() < smallest->size()) {
+                    smallest = &entities;
+                }
+            };
+            std::apply([&pick](auto*... pools) { (pick(pools->Entities()), ...); }, m_owned);
+            std::apply([&pick](auto*... pools) { (pick(pools->Entities()), ...); }, m_observed);
+
+            // Copy: inserting into an owning group reorders the pools being scanned
+            const std::vector<EntityID> candidates = *smallest;
+            for (EntityID entity : candidates) {
+                if (Matches(entity)) {
+                    Insert(entity);
+                }
+            }
+        }
+    };
+}
+
+#endif // ECS_GROUP_HPP
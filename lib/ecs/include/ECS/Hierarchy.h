@@ -0,0 +1,157 @@
+/**
+ * @file Hierarchy.h
+ * @brief Parent/children relationships between entities
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the Hierarchy class, which links entities into trees.
+ * Each entity slot stores its parent and its place in the parent's child
+ * list, so attaching, detaching and walking the children of an entity cost
+ * O(1) per link, independently of the size of the world.
+ */
+
+#ifndef ECS_HIERARCHY_HPP
+#define ECS_HIERARCHY_HPP
+
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief Intrusive parent -> children links, indexed by entity slot
+     *
+     * Children are kept in a doubly linked list in attachment order. The
+     * Hierarchy only stores links; the World validates handles, prevents
+     * cycles and applies cascading destruction.
+     */
+    class Hierarchy {
+    private:
+        /**
+         * @brief Links of one entity
+         */
+        struct Node {
+            EntityID parent = INVALID_ENTITY;       ///< Parent, or INVALID_ENTITY for a root
+            EntityID firstChild = INVALID_ENTITY;   ///< Oldest child
+            EntityID lastChild = INVALID_ENTITY;    ///< Newest child
+            EntityID prevSibling = INVALID_ENTITY;  ///< Previous child of the same parent
+            EntityID nextSibling = INVALID_ENTITY;  ///< Next child of the same parent
+            std::uint32_t childCount = 0;           ///< Number of children
+            bool destroyWithParent = false;         ///< Destroyed when the parent is
+        };
+
+        /**
+         * @brief Links indexed by entity slot index
+         */
+        std::vector<Node> m_nodes;
+
+        /**
+         * @brief Gets the links of an entity, growing the table if needed
+         *
+         * @param entity The entity
+         * @return Node& Its links
+         */
+        Node& NodeOf(EntityID entity);
+
+        /**
+         * @brief Gets the links of an entity if the table covers it
+         *
+         * @param entity The entity
+         * @return const Node* Its links, or nullptr (no link at all)
+         */
+        const Node* Find(EntityID entity) const {
+            const std::uint32_t index = GetEntityIndex(entity);
+            return index < m_nodes.size() ? &m_nodes[index] : nullptr;
+        }
+
+    public:
+        /**
+         * @brief Makes an entity the last child of another
+         *
+         * The child is detached from its current parent first.
+         *
+         * @param child The child entity
+         * @param parent The parent entity
+         * @param destroyWithParent Whether destroying the parent destroys the child
+         */
+        void Attach(EntityID child, EntityID parent, bool destroyWithParent);
+
+        /**
+         * @brief Unlinks an entity from its parent, if any
+         *
+         * @param child The entity to make a root
+         */
+        void Detach(EntityID child);
+
+        /**
+         * @brief Gets the parent of an entity
+         *
+         * @param child The entity
+         * @return EntityID The parent, or INVALID_ENTITY for a root
+         */
+        EntityID GetParent(EntityID child) const {
+            const Node* node = Find(child);
+            return node ? node->parent : INVALID_ENTITY;
+        }
+
+        /**
+         * @brief Gets the number of children of an entity
+         *
+         * @param parent The entity
+         * @return std::size_t Child count
+         */
+        std::size_t GetChildCount(EntityID parent) const {
+            const Node* node = Find(parent);
+            return node ? node->childCount : 0;
+        }
+
+        /**
+         * @brief Checks whether an entity is destroyed along with its parent
+         *
+         * @param child The entity
+         * @return true if it was attached with destroyWithParent
+         */
+        bool DestroysWithParent(EntityID child) const {
+            const Node* node = Find(child);
+            return node && node->parent != INVALID_ENTITY && node->destroyWithParent;
+        }
+
+        /**
+         * @brief Checks whether an entity is an ancestor of another
+         *
+         * @param ancestor The candidate ancestor
+         * @param entity The entity whose parent chain is walked
+         * @return true if ancestor is entity's parent, grandparent, ...
+         */
+        bool IsAncestor(EntityID ancestor, EntityID entity) const;
+
+        /**
+         * @brief Calls a function for every child of an entity, in attachment order
+         *
+         * The next child is read before the call, so the function may detach
+         * the child it is given.
+         *
+         * @tparam Func Callable taking an EntityID
+         * @param parent The entity whose children are visited
+         * @param func Function to call
+         */
+        template<typename Func>
+        void EachChild(EntityID parent, Func&& func) const {
+            const Node* node = Find(parent);
+            EntityID child = node ? node->firstChild : INVALID_ENTITY;
+            while (child != INVALID_ENTITY) {
+                const EntityID next = m_nodes[GetEntityIndex(child)].nextSibling;
+                func(child);
+                child = next;
+            }
+        }
+
+        /**
+         * @brief Removes every link
+         */
+        void Clear() { m_nodes.clear(); }
+    };
+}
+
+#endif // ECS_HIERARCHY_HPP
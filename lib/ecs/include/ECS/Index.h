@@ -0,0 +1,313 @@
+/**
+ * @file Index.h
+ * @brief Secondary indexes from a component field to the entities holding it
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the ComponentIndex class, a hash index mapping the key
+ * extracted from each component of a type to the entities owning such a
+ * component. The index is created once per (component type, key extractor)
+ * pair and kept up to date through the component signals, so lookups such
+ * as "players in room X" no longer scan the whole pool.
+ */
+
+#ifndef ECS_INDEX_HPP
+#define ECS_INDEX_HPP
+
+#include "Types.h"
+#include "Signal.h"
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    template<typename T>
+    class ComponentArray;
+
+    /**
+     * @brief Type-erased interface the ComponentManager uses to own indexes
+     */
+    class IComponentIndex {
+    public:
+        /**
+         * @brief Virtual destructor for proper cleanup
+         */
+        virtual ~IComponentIndex() = default;
+
+        /**
+         * @brief Recomputes every key from scratch
+         *
+         * Used when the index is created and after the component storage was cleared.
+         */
+        virtual void Rebuild() = 0;
+
+        /**
+         * @brief Applies the updates recorded since the last sync point
+         *
+         * Called by ComponentManager::DispatchQueuedEvents(), while no system runs.
+         */
+        virtual void Sync() {}
+    };
+
+    /**
+     * @brief Hash multimap from a key extracted from T to the entities owning T
+     *
+     * Entries are added on OnConstruct<T> and removed on OnDestroy<T>. On
+     * OnUpdate<T> the entity is only marked stale and its key re-extracted
+     * by the next lookup, because ModifyComponent() notifies before the
+     * caller writes. Key fields must therefore be changed through
+     * ModifyComponent()/MarkChanged() or by replacing the component; plain
+     * writes through GetComponent() are not seen.
+     *
+     * Every method locks the index, so lookups may run from several threads
+     * (systems reading the index should declare a read of T).
+     *
+     * @tparam T The indexed component type
+     * @tparam KeyOf Default-constructible callable returning the key of a const T&;
+     *         the key must be hashable with std::hash and equality comparable
+     *
+     * @example
+     * struct ByRoom { EntityID operator()(const LinkedRoom& link) const { return link.room_id; } };
+     * for (EntityID member : world.Index<LinkedRoom, ByRoom>().Find(room)) { ... }
+     */
+    template<typename T, typename KeyOf>
+    class ComponentIndex : public IComponentIndex {
+    public:
+        /**
+         * @brief Type of the keys
+         */
+        using Key = std::decay_t<std::invoke_result_t<const KeyOf&, const T&>>;
+
+    private:
+        /**
+         * @brief Storage of the indexed components
+         */
+        ComponentArray<T>* m_array;
+
+        /**
+         * @brief Signals of T the index listens to
+         */
+        ComponentSignals& m_signals;
+
+        ConnectionID m_constructID = 0;
+        ConnectionID m_updateID = 0;
+        ConnectionID m_destroyID = 0;
+
+        /**
+         * @brief Key extractor
+         */
+        KeyOf m_keyOf;
+
+        /**
+         * @brief Protects every member below
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Where an indexed entity is filed
+         */
+        struct Filed {
+            Key key;
+
+            /**
+             * @brief Position of the entity in the bucket of key
+             */
+            std::size_t slot;
+        };
+
+        /**
+         * @brief Entities per key, unordered so any of them can be removed in constant time
+         */
+        std::unordered_map<Key, std::vector<EntityID>> m_entities;
+
+        /**
+         * @brief Key and bucket position of each indexed entity
+         */
+        std::unordered_map<EntityID, Filed> m_filed;
+
+        /**
+         * @brief Entities whose component was updated since the last lookup
+         */
+        std::vector<EntityID> m_stale;
+
+        /**
+         * @brief Files an entity under the key of its component (lock held)
+         *
+         * @param entity The entity owning a T
+         */
+        void Insert(EntityID entity) {
+            const T* component = m_array->GetComponent(entity);
+            if (!component) {
+                return;
+            }
+            auto filed = m_filed.find(entity);
+            if (filed != m_filed.end()) {
+                EraseFromBucket(filed->second, entity);
+                m_filed.erase(filed);
+            }
+            Key key = m_keyOf(*component);
+            std::vector<EntityID>& bucket = m_entities[key];
+            m_filed.insert_or_assign(entity, Filed{std::move(key), bucket.size()});
+            bucket.push_back(entity);
+        }
+
+        /**
+         * @brief Removes an entity from its bucket (lock held)
+         *
+         * The last entity of the bucket takes its slot, so tearing down a
+         * whole bucket one entity at a time stays linear.
+         *
+         * @param filed Where the entity is filed; its slot is left dangling
+         * @param entity The entity to remove
+         */
+        void EraseFromBucket(const Filed& filed, EntityID entity) {
+            auto bucket = m_entities.find(filed.key);
+            if (bucket == m_entities.end()) {
+                return;
+            }
+            auto& entities = bucket->second;
+            if (filed.slot >= entities.size() || entities[filed.slot] != entity) {
+                return;
+            }
+            const EntityID moved = entities.back();
+            entities[filed.slot] = moved;
+            entities.pop_back();
+            if (moved != entity) {
+                m_filed[moved].slot = filed.slot;
+            }
+            if (entities.empty()) {
+                m_entities.erase(bucket);
+            }
+        }
+
+        /**
+         * @brief Re-extracts the key of every stale entity (lock held)
+         */
+        void Refresh() {
+            for (EntityID entity : m_stale) {
+                auto filed = m_filed.find(entity);
+                const T* component = m_array->GetComponent(entity);
+                if (filed == m_filed.end() || !component) {
+                    continue;   // removed since it was updated
+                }
+                Key key = m_keyOf(*component);
+                if (key == filed->second.key) {
+                    continue;
+                }
+                EraseFromBucket(filed->second, entity);
+                std::vector<EntityID>& bucket = m_entities[key];
+                filed->second = Filed{std::move(key), bucket.size()};
+                bucket.push_back(entity);
+            }
+            m_stale.clear();
+        }
+
+    public:
+        /**
+         * @brief Connects the index to the signals of T
+         *
+         * Call Rebuild() afterwards to index the components that already exist.
+         *
+         * @param array Storage of the indexed components
+         * @param signals Lifecycle signals of T
+         */
+        ComponentIndex(ComponentArray<T>* array, ComponentSignals& signals)
+            : m_array(array), m_signals(signals) {
+            m_constructID = m_signals.construct.Connect([this](EntityID entity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Insert(entity);
+            });
+            m_updateID = m_signals.update.Connect([this](EntityID entity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stale.push_back(entity);
+            });
+            m_destroyID = m_signals.destroy.Connect([this](EntityID entity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto filed = m_filed.find(entity);
+                if (filed != m_filed.end()) {
+                    EraseFromBucket(filed->second, entity);
+                    m_filed.erase(filed);
+                }
+            });
+        }
+
+        /**
+         * @brief Disconnects the index from the signals of T
+         */
+        ~ComponentIndex() override {
+            m_signals.construct.Disconnect(m_constructID);
+            m_signals.update.Disconnect(m_updateID);
+            m_signals.destroy.Disconnect(m_destroyID);
+        }
+
+        ComponentIndex(const ComponentIndex&) = delete;
+        ComponentIndex& operator=(const ComponentIndex&) = delete;
+
+        /**
+         * @brief Gets every entity whose component has the given key
+         *
+         * @param key The key to look up
+         * @return std::vector<EntityID> Matching entities, in no particular order
+         */
+        std::vector<EntityID> Find(const Key& key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refresh();
+            auto bucket = m_entities.find(key);
+            return bucket != m_entities.end() ? bucket->second : std::vector<EntityID>();
+        }
+
+        /**
+         * @brief Gets an entity indexed under a key, for keys expected to be unique
+         *
+         * @param key The key to look up
+         * @return EntityID The entity, or INVALID_ENTITY if none matches
+         */
+        EntityID FindFirst(const Key& key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refresh();
+            auto bucket = m_entities.find(key);
+            return bucket != m_entities.end() ? bucket->second.front() : INVALID_ENTITY;
+        }
+
+        /**
+         * @brief Gets the number of entities indexed under a key
+         *
+         * @param key The key to look up
+         * @return std::size_t Matching entity count
+         */
+        std::size_t Count(const Key& key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refresh();
+            auto bucket = m_entities.find(key);
+            return bucket != m_entities.end() ? bucket->second.size() : 0;
+        }
+
+        /**
+         * @brief Checks whether at least one entity is indexed under a key
+         *
+         * @param key The key to look up
+         * @return true if a component has this key
+         */
+        bool Contains(const Key& key) {
+            return Count(key) > 0;
+        }
+
+        /**
+         * @brief Re-indexes every component of T
+         */
+        void Rebuild() override {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_entities.clear();
+            m_filed.clear();
+            m_stale.clear();
+            for (auto& pair : *m_array) {
+                Insert(pair.first);
+            }
+        }
+    };
+}
+
+#endif // ECS_INDEX_HPP
@@ -0,0 +1,292 @@
+/**
+ * @file Partition.h
+ * @brief Categorical partitions of a component type by a small enum field
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the ComponentPartition class, which splits the
+ * entities owning a component type into one EntityBitset per value of a
+ * small enum (or integer) field, such as the TeamType of a Team. Queries
+ * like "all enemies" become a scan of one bitset instead of a test of
+ * every component. Like ComponentIndex, the partition is created once per
+ * (component type, key extractor) pair and kept up to date through the
+ * component signals.
+ */
+
+#ifndef ECS_PARTITION_HPP
+#define ECS_PARTITION_HPP
+
+#include "Types.h"
+#include "Signal.h"
+#include "Index.h"
+#include "Tag.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief One bitset of entities per value of a small field of T
+     *
+     * Follows the update rules of ComponentIndex: entities are filed on
+     * OnConstruct<T>, unfiled on OnDestroy<T>, and re-filed after
+     * OnUpdate<T> by the next sync point or query. Key values are used as bitset numbers, so
+     * they should be small and dense (enumerators such as 0..3).
+     *
+     * Pending updates are applied at every sync point (see Sync()) and by
+     * queries, under a lock; the scan itself runs without it, so the
+     * visitor may destroy entities (their bits are cleared and skipped).
+     * Systems reading the partition should declare a read of T, which keeps
+     * writers of T from running alongside them.
+     *
+     * @tparam T The partitioned component type
+     * @tparam KeyOf Default-constructible callable returning the category of a const T&,
+     *         an enum or an unsigned integer
+     *
+     * @example
+     * struct ByTeam { TeamType operator()(const Team& team) const { return team.team; } };
+     * world.Partition<Team, ByTeam>().Each(TeamType::Enemy, [&](EntityID enemy) { ... });
+     */
+    template<typename T, typename KeyOf>
+    class ComponentPartition : public IComponentIndex {
+    public:
+        /**
+         * @brief Type of the categories
+         */
+        using Key = std::decay_t<std::invoke_result_t<const KeyOf&, const T&>>;
+
+        static_assert(std::is_enum_v<Key> || std::is_integral_v<Key>,
+                      "ECS: partition keys must be enums or integers");
+
+    private:
+        /**
+         * @brief Storage of the partitioned components
+         */
+        ComponentArray<T>* m_array;
+
+        /**
+         * @brief Signals of T the partition listens to
+         */
+        ComponentSignals& m_signals;
+
+        ConnectionID m_constructID = 0;
+        ConnectionID m_updateID = 0;
+        ConnectionID m_destroyID = 0;
+
+        /**
+         * @brief Category extractor
+         */
+        KeyOf m_keyOf;
+
+        /**
+         * @brief Protects the members below against concurrent queries and signals
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Members of each category, indexed by category number
+         *
+         * A deque, so filing a new category during Each() does not move the
+         * bitset being scanned.
+         */
+        std::deque<EntityBitset> m_categories;
+
+        /**
+         * @brief Handle of the entity filed in each slot, or INVALID_ENTITY
+         */
+        std::vector<EntityID> m_handles;
+
+        /**
+         * @brief Category number of the entity filed in each slot
+         */
+        std::vector<std::size_t> m_filedUnder;
+
+        /**
+         * @brief Entities whose component was updated since the last query
+         */
+        std::vector<EntityID> m_stale;
+
+        /**
+         * @brief Converts a key to its category number
+         *
+         * @param key The key
+         * @return std::size_t Category number
+         */
+        static std::size_t CategoryOf(const Key& key) {
+            return static_cast<std::size_t>(key);
+        }
+
+        /**
+         * @brief Files an entity in a category (lock held)
+         *
+         * @param entity The entity
+         * @param category The category number
+         */
+        void File(EntityID entity, std::size_t category) {
+            const std::uint32_t index = GetEntityIndex(entity);
+            if (index >= m_handles.size()) {
+                m_handles.resize(index + 1, INVALID_ENTITY);
+                m_filedUnder.resize(index + 1, 0);
+            }
+            if (category >= m_categories.size()) {
+                m_categories.resize(category + 1);
+            }
+            m_handles[index] = entity;
+            m_filedUnder[index] = category;
+            m_categories[category].Set(index);
+        }
+
+        /**
+         * @brief Removes an entity from its category (lock held)
+         *
+         * @param entity The entity
+         * @return true if it was filed
+         */
+        bool Unfile(EntityID entity) {
+            const std::uint32_t index = GetEntityIndex(entity);
+            if (index >= m_handles.size() || m_handles[index] != entity) {
+                return false;
+            }
+            m_categories[m_filedUnder[index]].Reset(index);
+            m_handles[index] = INVALID_ENTITY;
+            return true;
+        }
+
+        /**
+         * @brief Files an entity under the category of its component (lock held)
+         *
+         * @param entity The entity owning a T
+         */
+        void Insert(EntityID entity) {
+            const T* component = m_array->GetComponent(entity);
+            if (component) {
+                File(entity, CategoryOf(m_keyOf(*component)));
+            }
+        }
+
+        /**
+         * @brief Re-files every stale entity (lock held)
+         */
+        void Refresh() {
+            for (EntityID entity : m_stale) {
+                if (Unfile(entity)) {   // skipped if removed since it was updated
+                    Insert(entity);
+                }
+            }
+            m_stale.clear();
+        }
+
+    public:
+        /**
+         * @brief Connects the partition to the signals of T
+         *
+         * Call Rebuild() afterwards to file the components that already exist.
+         *
+         * @param array Storage of the partitioned components
+         * @param signals Lifecycle signals of T
+         */
+        ComponentPartition(ComponentArray<T>* array, ComponentSignals& signals)
+            : m_array(array), m_signals(signals) {
+            m_constructID = m_signals.construct.Connect([this](EntityID entity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Insert(entity);
+            });
+            m_updateID = m_signals.update.Connect([this](EntityID entity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stale.push_back(entity);
+            });
+            m_destroyID = m_signals.destroy.Connect([this](EntityID entity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Unfile(entity);
+            });
+        }
+
+        /**
+         * @brief Disconnects the partition from the signals of T
+         */
+        ~ComponentPartition() override {
+            m_signals.construct.Disconnect(m_constructID);
+            m_signals.update.Disconnect(m_updateID);
+            m_signals.destroy.Disconnect(m_destroyID);
+        }
+
+        ComponentPartition(const ComponentPartition&) = delete;
+        ComponentPartition& operator=(const ComponentPartition&) = delete;
+
+        /**
+         * @brief Calls a function for every entity of a category, in slot order
+         *
+         * @tparam Func Callable taking an EntityID
+         * @param key The category
+         * @param func Function to call; may destroy entities
+         */
+        template<typename Func>
+        void Each(const Key& key, Func&& func) {
+            const std::size_t category = CategoryOf(key);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Refresh();
+                if (category >= m_categories.size()) {
+                    return;
+                }
+            }
+            m_categories[category].ForEach([this, &func](std::uint32_t index) {
+                func(m_handles[index]);
+            });
+        }
+
+        /**
+         * @brief Gets the number of entities in a category
+         *
+         * @param key The category
+         * @return std::size_t Member count
+         */
+        std::size_t Count(const Key& key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refresh();
+            const std::size_t category = CategoryOf(key);
+            return category < m_categories.size() ? m_categories[category].Count() : 0;
+        }
+
+        /**
+         * @brief Checks whether an entity is in a category
+         *
+         * @param entity The entity
+         * @param key The category
+         * @return true if the entity owns a T whose key is key
+         */
+        bool Contains(EntityID entity, const Key& key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refresh();
+            const std::uint32_t index = GetEntityIndex(entity);
+            return index < m_handles.size() && m_handles[index] == entity && m_filedUnder[index] == CategoryOf(key);
+        }
+
+        /**
+         * @brief Re-files the entities updated since the last query
+         */
+        void Sync() override {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Refresh();
+        }
+
+        /**
+         * @brief Re-files every component of T
+         */
+        void Rebuild() override {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_categories.clear();
+            m_handles.clear();
+            m_filedUnder.clear();
+            m_stale.clear();
+            for (auto& pair : *m_array) {
+                Insert(pair.first);
+            }
+        }
+    };
+}
+
+#endif // ECS_PARTITION_HPP
@@ -0,0 +1,144 @@
+/**
+ * @file Prefab.h
+ * @brief Reusable entity templates for batched instantiation
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the Prefab class, a list of prototype components
+ * copied onto new entities by World::Instantiate(). A prefab is built once
+ * (e.g. "basic enemy", "player projectile") and stamped onto any number of
+ * entities at a time, one component type after the other, with a single
+ * storage reservation per type.
+ */
+
+#ifndef ECS_PREFAB_HPP
+#define ECS_PREFAB_HPP
+
+#include "Types.h"
+#include "Component.h"
+#include "ComponentManager.h"
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief Template of an entity: a set of prototype components
+     *
+     * Each With<T>() stores a T built from the given arguments; instantiating
+     * copies it onto every new entity. Tag types are added as tags.
+     *
+     * @example
+     * static const ECS::Prefab debris = ECS::Prefab("Debris")
+     *     .With<Position>(1340.0f, 0.0f)
+     *     .With<Health>(1000)
+     *     .With<Team>(TeamType::Enemy);
+     * world.Instantiate(debris, 4, [&](ECS::EntityID e, std::size_t i) {
+     *     world.GetComponent<Position>(e)->y = 80.0f + 180.0f * i;
+     * });
+     */
+    class Prefab {
+    private:
+        /**
+         * @brief Copies one prototype onto a batch of entities
+         */
+        using Stamp = std::function<void(ComponentManager&, const std::vector<EntityID>&)>;
+
+        /**
+         * @brief Name, for logs and debugging
+         */
+        std::string m_name;
+
+        /**
+         * @brief One stamp per component type, in the order they were given
+         */
+        std::vector<std::pair<ComponentTypeID, Stamp>> m_stamps;
+
+        /**
+         * @brief Component types of the prefab
+         */
+        Signature m_signature;
+
+        friend class World;
+
+        /**
+         * @brief Adds every prototype component to a batch of entities
+         *
+         * @param components The component manager of the world
+         * @param entities The alive entities to stamp
+         */
+        void Apply(ComponentManager& components, const std::vector<EntityID>& entities) const {
+            for (const auto& stamp : m_stamps) {
+                stamp.second(components, entities);
+            }
+        }
+
+    public:
+        /**
+         * @brief Creates an empty prefab
+         *
+         * @param name Name of the prefab
+         */
+        explicit Prefab(std::string name = "") : m_name(std::move(name)) {}
+
+        /**
+         * @brief Adds (or replaces) the prototype component of type T
+         *
+         * @tparam T The component type, copy-constructible (or an empty tag type)
+         * @tparam Args The argument types for the component constructor
+         * @param args Arguments to forward to the component constructor
+         * @return Prefab& This prefab, for chaining
+         */
+        template<typename T, typename... Args>
+        Prefab& With(Args&&... args) {
+            static_assert(std::is_copy_constructible_v<T>, "ECS: prefab components must be copy-constructible");
+            const ComponentTypeID typeID = Component<T>::GetStaticTypeID();
+
+            Stamp stamp;
+            if constexpr (IS_TAG_COMPONENT<T>) {
+                stamp = [](ComponentManager& components, const std::vector<EntityID>& entities) {
+                    for (EntityID entity : entities) {
+                        components.AddTag<T>(entity);
+                    }
+                };
+            } else {
+                stamp = [prototype = T(std::forward<Args>(args)...)](ComponentManager& components,
+                                                                     const std::vector<EntityID>& entities) {
+                    ComponentArray<T>* array = components.GetAllComponents<T>();
+                    array->Reserve(array->Size() + entities.size());
+                    for (EntityID entity : entities) {
+                        components.AddComponent<T>(entity, prototype);
+                    }
+                };
+            }
+
+            if (m_signature.test(typeID)) {
+                for (auto& entry : m_stamps) {
+                    if (entry.first == typeID) {
+                        entry.second = std::move(stamp);
+                    }
+                }
+            } else {
+                m_signature.set(typeID);
+                m_stamps.emplace_back(typeID, std::move(stamp));
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Gets the name of the prefab
+         * @return const std::string& The name
+         */
+        const std::string& GetName() const { return m_name; }
+
+        /**
+         * @brief Gets the component types every instance receives
+         * @return const Signature& The signature
+         */
+        const Signature& GetSignature() const { return m_signature; }
+    };
+}
+
+#endif // ECS_PREFAB_HPP
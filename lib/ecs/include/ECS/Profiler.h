@@ -0,0 +1,157 @@
+/**
+ * @file Profiler.h
+ * @brief Built-in timing instrumentation of the system scheduler
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the rolling timing histograms the SystemManager fills
+ * with the wall time of every system and of every UpdateSystems() call, and
+ * the ProfileReport returned by World::GetProfileReport(). Recording a sample
+ * is two steady_clock reads and one store, cheap enough to stay on in
+ * production; building with ECS_PROFILING=0 (CMake option ECS_PROFILING=OFF)
+ * removes the recording entirely and reports are then empty.
+ */
+
+#ifndef ECS_PROFILER_HPP
+#define ECS_PROFILER_HPP
+
+#include "Types.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef ECS_PROFILING
+#define ECS_PROFILING 1
+#endif
+
+namespace ECS {
+    /**
+     * @brief Percentiles of a timing histogram, in microseconds
+     */
+    struct TimingStats {
+        /**
+         * @brief Number of samples the percentiles were computed from
+         */
+        std::size_t samples = 0;
+
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    /**
+     * @brief Timing of one system over the last frames
+     */
+    struct SystemTiming {
+        std::string name;
+        TimingStats stats;
+    };
+
+    /**
+     * @brief Number of components stored for one component type
+     */
+    struct ComponentCount {
+        std::string typeName;
+        std::size_t count = 0;
+    };
+
+    /**
+     * @brief Snapshot of the scheduler instrumentation
+     */
+    struct ProfileReport {
+        /**
+         * @brief Number of UpdateSystems() calls since the world was created
+         */
+        std::uint64_t frame = 0;
+
+        /**
+         * @brief Wall time of whole UpdateSystems() calls, sync points included
+         */
+        TimingStats tick;
+
+        /**
+         * @brief Wall time of each registered system, in priority order
+         */
+        std::vector<SystemTiming> systems;
+
+        /**
+         * @brief Component count of each component type the world has used
+         */
+        std::vector<ComponentCount> components;
+    };
+
+    /**
+     * @brief Formats a report as a human-readable table, one line per entry
+     *
+     * @param report The report to format
+     * @return std::string The formatted report, ending with a newline
+     */
+    std::string FormatProfileReport(const ProfileReport& report);
+
+    /**
+     * @brief Fixed-size window of the last durations recorded
+     *
+     * Recording overwrites the oldest sample; percentiles are only computed
+     * when asked for, on a copy of the window. Not synchronized: each
+     * histogram is written by the thread running its system and read
+     * between UpdateSystems() calls.
+     */
+    class RollingHistogram {
+    public:
+        /**
+         * @brief Number of samples kept, about 4 seconds at 60 frames per second
+         */
+        static constexpr std::size_t WINDOW = 256;
+
+    private:
+        /**
+         * @brief Samples in nanoseconds, a ring buffer of the last m_count records
+         */
+        std::array<std::uint32_t, WINDOW> m_samples{};
+
+        /**
+         * @brief Slot the next sample is written to
+         */
+        std::size_t m_next = 0;
+
+        /**
+         * @brief Number of valid samples, at most WINDOW
+         */
+        std::size_t m_count = 0;
+
+    public:
+        /**
+         * @brief Records one duration
+         *
+         * @param duration The duration; saturated at about 4.29 seconds
+         */
+        void Record(std::chrono::steady_clock::duration duration) {
+            const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            m_samples[m_next] = nanoseconds > 0xFFFFFFFF ? 0xFFFFFFFFu : static_cast<std::uint32_t>(nanoseconds);
+            m_next = (m_next + 1) % WINDOW;
+            if (m_count < WINDOW) {
+                ++m_count;
+            }
+        }
+
+        /**
+         * @brief Computes the percentiles of the samples in the window
+         * @return TimingStats The percentiles, all zero without samples
+         */
+        TimingStats GetStats() const;
+
+        /**
+         * @brief Forgets every sample
+         */
+        void Clear() {
+            m_next = 0;
+            m_count = 0;
+        }
+    };
+}
+
+#endif // ECS_PROFILER_HPP
@@ -0,0 +1,195 @@
+/**
+ * @file Signal.h
+ * @brief Component lifecycle signals for reactive systems
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the Signal class, a list of listeners called with an
+ * EntityID whenever a component of a given type is constructed, updated or
+ * destroyed. Listeners either run synchronously at the point of change or
+ * have their events queued and delivered at the next sync point, so
+ * reactive systems do work proportional to the number of events instead of
+ * rescanning the world every frame.
+ */
+
+#ifndef ECS_SIGNAL_HPP
+#define ECS_SIGNAL_HPP
+
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief How a listener receives the events of a signal
+     */
+    enum class Dispatch : std::uint8_t {
+        Immediate,  ///< Called synchronously, on the thread that made the change
+        Queued      ///< Recorded, then called on DispatchQueued() (at the next sync point)
+    };
+
+    /**
+     * @brief Handle identifying a listener connected to a signal
+     */
+    using ConnectionID = std::uint32_t;
+
+    /**
+     * @brief Listeners notified with the EntityID of a component event
+     *
+     * Immediate listeners run wherever the change happens, possibly on a
+     * worker thread for updates made by a parallel system; they must not
+     * make structural changes (record them in a CommandBuffer instead).
+     * Queued listeners only run from DispatchQueued(), on a single thread,
+     * where anything is allowed; the entity may have been destroyed since
+     * the event was recorded, check World::IsEntityAlive() if that matters.
+     *
+     * Emitting is safe from several threads at once. Connecting and
+     * disconnecting are not, and a listener must not connect to or
+     * disconnect from the signal that is calling it.
+     *
+     * @example
+     * world.OnDestroy<PlayerConn>().Connect([&](ECS::EntityID player) { m_dirty = true; });
+     */
+    class Signal {
+    public:
+        /**
+         * @brief Function called with the entity the event is about
+         */
+        using Listener = std::function<void(EntityID)>;
+
+    private:
+        /**
+         * @brief A connected listener and its undelivered events
+         */
+        struct Connection {
+            ConnectionID id;
+            Dispatch mode;
+            Listener listener;
+            std::vector<EntityID> pending;
+        };
+
+        /**
+         * @brief Connected listeners, in connection order
+         */
+        std::vector<Connection> m_connections;
+
+        /**
+         * @brief Events taken out of a connection during DispatchQueued(), reused across calls
+         */
+        std::vector<EntityID> m_delivering;
+
+        /**
+         * @brief Protects the pending events of queued listeners
+         */
+        std::mutex m_queueMutex;
+
+        /**
+         * @brief Id given to the next connection
+         */
+        ConnectionID m_nextID = 1;
+
+    public:
+        Signal() = default;
+
+        Signal(const Signal&) = delete;
+        Signal& operator=(const Signal&) = delete;
+
+        /**
+         * @brief Connects a listener
+         *
+         * @param listener Function called with the entity of each event
+         * @param mode Whether events are delivered immediately or at the next sync point
+         * @return ConnectionID Handle to pass to Disconnect()
+         */
+        ConnectionID Connect(Listener listener, Dispatch mode = Dispatch::Immediate) {
+            const ConnectionID id = m_nextID++;
+            m_connections.push_back({id, mode, std::move(listener), {}});
+            return id;
+        }
+
+        /**
+         * @brief Disconnects a listener, dropping its undelivered events
+         *
+         * @param id Handle returned by Connect()
+         * @return true if the listener was connected
+         */
+        bool Disconnect(ConnectionID id) {
+            for (auto it = m_connections.begin(); it != m_connections.end(); ++it) {
+                if (it->id == id) {
+                    m_connections.erase(it);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Checks whether no listener is connected
+         * @return true if emitting would do nothing
+         */
+        bool Empty() const { return m_connections.empty(); }
+
+        /**
+         * @brief Notifies every listener of an event
+         *
+         * @param entity The entity the event is about
+         */
+        void Emit(EntityID entity) {
+            for (std::size_t i = 0; i < m_connections.size(); ++i) {
+                Connection& connection = m_connections[i];
+                if (connection.mode == Dispatch::Immediate) {
+                    connection.listener(entity);
+                } else {
+                    std::lock_guard<std::mutex> lock(m_queueMutex);
+                    connection.pending.push_back(entity);
+                }
+            }
+        }
+
+        /**
+         * @brief Delivers the events recorded for queued listeners, in emission order
+         *
+         * Events emitted while dispatching are kept for the next call.
+         */
+        void DispatchQueued() {
+            for (std::size_t i = 0; i < m_connections.size(); ++i) {
+                {
+                    std::lock_guard<std::mutex> lock(m_queueMutex);
+                    if (m_connections[i].pending.empty()) {
+                        continue;
+                    }
+                    m_delivering.swap(m_connections[i].pending);
+                }
+                for (EntityID entity : m_delivering) {
+                    m_connections[i].listener(entity);
+                }
+                m_delivering.clear();
+            }
+        }
+
+        /**
+         * @brief Drops every undelivered event; listeners stay connected
+         */
+        void ClearQueued() {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            for (auto& connection : m_connections) {
+                connection.pending.clear();
+            }
+        }
+    };
+
+    /**
+     * @brief Lifecycle signals of one component type
+     */
+    struct ComponentSignals {
+        Signal construct;   ///< Component added to an entity that did not have it
+        Signal update;      ///< Component replaced, or modified through ModifyComponent()/MarkChanged()
+        Signal destroy;     ///< Component about to be removed (still readable)
+    };
+}
+
+#endif // ECS_SIGNAL_HPP
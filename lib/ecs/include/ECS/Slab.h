@@ -0,0 +1,313 @@
+/**
+ * @file Slab.h
+ * @brief Slab-backed containers used by component storage
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains SlabVector, the dense component storage of a
+ * ComponentArray, and SlabPool, the allocator of components that cannot be
+ * moved. Both carve objects out of fixed-size slabs that are allocated once
+ * and kept for the lifetime of the container, so steady-state creation and
+ * destruction of components performs no heap allocation.
+ */
+
+#ifndef ECS_SLAB_HPP
+#define ECS_SLAB_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief Target size in bytes of one slab
+     */
+    inline constexpr std::size_t SLAB_BYTES = 16 * 1024;
+
+    /**
+     * @brief Number of objects of type T per slab
+     *
+     * The largest power of two fitting in SLAB_BYTES, at least 16, so slot
+     * lookups are a shift and a mask.
+     *
+     * @tparam T The object type
+     * @return std::size_t Objects per slab
+     */
+    template<typename T>
+    constexpr std::size_t SlabCapacity() {
+        std::size_t capacity = 16;
+        while (capacity * 2 * sizeof(T) <= SLAB_BYTES) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    /**
+     * @brief Uninitialized storage for SlabCapacity<T>() objects
+     *
+     * @tparam T The object type
+     */
+    template<typename T>
+    struct Slab {
+        alignas(T) unsigned char bytes[sizeof(T) * SlabCapacity<T>()];
+
+        /**
+         * @brief Gets the address of a slot
+         *
+         * @param index Slot index in [0, SlabCapacity<T>())
+         * @return T* Address of the slot (the object may not be constructed)
+         */
+        T* Slot(std::size_t index) {
+            return reinterpret_cast<T*>(bytes + index * sizeof(T));
+        }
+    };
+
+    /**
+     * @brief Dense sequence growing and shrinking at the back, stored in slabs
+     *
+     * Unlike std::vector, growing never relocates existing elements: a new
+     * slab is appended instead. Slabs are kept when elements are popped or
+     * cleared, and reused by the next pushes.
+     *
+     * @tparam T The element type
+     */
+    template<typename T>
+    class SlabVector {
+    private:
+        static constexpr std::size_t CAPACITY = SlabCapacity<T>();
+
+        /**
+         * @brief Allocated slabs; elements [0, m_size) are constructed
+         */
+        std::vector<std::unique_ptr<Slab<T>>> m_slabs;
+
+        /**
+         * @brief Number of constructed elements
+         */
+        std::size_t m_size = 0;
+
+        /**
+         * @brief Gets the address of an element slot
+         *
+         * @param index Element index
+         * @return T* Address of the slot
+         */
+        T* Slot(std::size_t index) const {
+            return m_slabs[index / CAPACITY]->Slot(index % CAPACITY);
+        }
+
+    public:
+        SlabVector() = default;
+
+        /**
+         * @brief Destroys every element and releases the slabs
+         */
+        ~SlabVector() { Clear(); }
+
+        SlabVector(const SlabVector&) = delete;
+        SlabVector& operator=(const SlabVector&) = delete;
+
+        /**
+         * @brief Constructs an element at the back
+         *
+         * @tparam Args The argument types for the element constructor
+         * @param args Arguments to forward to the element constructor
+         * @return T& Reference to the new element
+         */
+        template<typename... Args>
+        T& EmplaceBack(Args&&... args) {
+            if (m_size == m_slabs.size() * CAPACITY) {
+                m_slabs.push_back(std::make_unique<Slab<T>>());
+            }
+            T* element = new (Slot(m_size)) T(std::forward<Args>(args)...);
+            ++m_size;
+            return *element;
+        }
+
+        /**
+         * @brief Destroys the last element; its slab is kept
+         */
+        void PopBack() {
+            --m_size;
+            std::launder(Slot(m_size))->~T();
+        }
+
+        /**
+         * @brief Destroys every element; the slabs are kept
+         */
+        void Clear() {
+            while (m_size > 0) {
+                PopBack();
+            }
+        }
+
+        /**
+         * @brief Allocates slabs up front
+         *
+         * @param capacity Number of elements to make room for
+         */
+        void Reserve(std::size_t capacity) {
+            while (m_slabs.size() * CAPACITY < capacity) {
+                m_slabs.push_back(std::make_unique<Slab<T>>());
+            }
+        }
+
+        /**
+         * @brief Gets an element
+         *
+         * @param index Element index in [0, Size())
+         * @return T& Reference to the element
+         */
+        T& operator[](std::size_t index) { return *std::launder(Slot(index)); }
+
+        /**
+         * @brief Gets an element (const)
+         *
+         * @param index Element index in [0, Size())
+         * @return const T& Reference to the element
+         */
+        const T& operator[](std::size_t index) const { return *std::launder(Slot(index)); }
+
+        /**
+         * @brief Gets the last element
+         * @return T& Reference to the last element
+         */
+        T& Back() { return (*this)[m_size - 1]; }
+
+        /**
+         * @brief Gets the number of elements stored contiguously from an index
+         *
+         * Elements of one slab are contiguous in memory: the run stops at the
+         * end of the slab holding index, or at Size().
+         *
+         * @param index Element index in [0, Size())
+         * @return std::size_t Length of the run starting at index
+         */
+        std::size_t RunFrom(std::size_t index) const {
+            return std::min(CAPACITY - index % CAPACITY, m_size - index);
+        }
+
+        /**
+         * @brief Gets the number of elements
+         * @return std::size_t Element count
+         */
+        std::size_t Size() const { return m_size; }
+
+        /**
+         * @brief Checks whether the vector has no element
+         * @return true if empty, false otherwise
+         */
+        bool Empty() const { return m_size == 0; }
+
+        /**
+         * @brief Gets the number of elements the allocated slabs can hold
+         * @return std::size_t Capacity
+         */
+        std::size_t Capacity() const { return m_slabs.size() * CAPACITY; }
+
+        /**
+         * @brief Copies every element to contiguous memory, one memcpy per slab
+         *
+         * Only available for trivially copyable element types.
+         *
+         * @param destination Buffer of at least Size() * sizeof(T) bytes
+         */
+        void CopyTo(void* destination) const {
+            static_assert(std::is_trivially_copyable_v<T>, "SlabVector::CopyTo requires a trivially copyable type");
+            auto* out = static_cast<unsigned char*>(destination);
+            for (std::size_t first = 0; first < m_size; first += CAPACITY) {
+                const std::size_t count = std::min(CAPACITY, m_size - first);
+                std::memcpy(out + first * sizeof(T), m_slabs[first / CAPACITY]->bytes, count * sizeof(T));
+            }
+        }
+    };
+
+    /**
+     * @brief Free-list allocator of objects with stable addresses
+     *
+     * Objects live in slabs and never move. Freed slots are kept in a free
+     * list and handed out again before any new slab is allocated.
+     *
+     * @tparam T The object type
+     */
+    template<typename T>
+    class SlabPool {
+    private:
+        static constexpr std::size_t CAPACITY = SlabCapacity<T>();
+
+        /**
+         * @brief Allocated slabs
+         */
+        std::vector<std::unique_ptr<Slab<T>>> m_slabs;
+
+        /**
+         * @brief Slots available for reuse
+         */
+        std::vector<T*> m_free;
+
+        /**
+         * @brief Number of slots of the last slab handed out so far
+         */
+        std::size_t m_used = CAPACITY;
+
+    public:
+        SlabPool() = default;
+
+        SlabPool(const SlabPool&) = delete;
+        SlabPool& operator=(const SlabPool&) = delete;
+
+        /**
+         * @brief Constructs an object in a free slot
+         *
+         * @tparam Args The argument types for the object constructor
+         * @param args Arguments to forward to the object constructor
+         * @return T* Pointer to the new object, stable until Free()
+         */
+        template<typename... Args>
+        T* Allocate(Args&&... args) {
+            const bool reused = !m_free.empty();
+            T* slot = nullptr;
+            if (reused) {
+                slot = m_free.back();
+            } else {
+                if (m_used == CAPACITY) {
+                    m_slabs.push_back(std::make_unique<Slab<T>>());
+                    m_used = 0;
+                }
+                slot = m_slabs.back()->Slot(m_used);
+            }
+
+            // Bookkeeping only once construction succeeded
+            T* object = new (slot) T(std::forward<Args>(args)...);
+            if (reused) {
+                m_free.pop_back();
+            } else {
+                ++m_used;
+            }
+            return object;
+        }
+
+        /**
+         * @brief Destroys an object and makes its slot reusable
+         *
+         * @param object Pointer returned by Allocate()
+         */
+        void Free(T* object) {
+            object->~T();
+            m_free.push_back(object);
+        }
+
+        /**
+         * @brief Gets the number of objects the allocated slabs can hold
+         * @return std::size_t Capacity
+         */
+        std::size_t Capacity() const { return m_slabs.size() * CAPACITY; }
+    };
+}
+
+#endif // ECS_SLAB_HPP
@@ -0,0 +1,110 @@
+/**
+ * @file Snapshot.h
+ * @brief Binary snapshots of world state
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the WorldSnapshot class, a single contiguous buffer
+ * holding a set of entities and their trivially copyable components, as
+ * produced by World::Snapshot() and consumed by World::Restore().
+ *
+ * Buffer layout (native endianness, no padding):
+ * - header: magic "ECSS", format version, entity count, then the entity handles;
+ * - one block per component type: type name hash, component size, component
+ *   count, the owning entity handles, then the component bytes.
+ */
+
+#ifndef ECS_SNAPSHOT_HPP
+#define ECS_SNAPSHOT_HPP
+
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief How World::Restore() maps snapshot entities to world entities
+     */
+    enum class RestoreMode : std::uint8_t {
+        Rollback,   ///< Entities still alive are rewound in place; the others are recreated
+        Clone       ///< Every snapshot entity is created anew (e.g. room cloning)
+    };
+
+    /**
+     * @brief Serialized entities and components
+     *
+     * Only trivially copyable components are saved, as raw bytes; other
+     * components (owning strings, sockets, ...) are left out. Component
+     * types are identified by the hash of their type name, not by their
+     * type ID, so a snapshot can be restored by another process of the same
+     * build, whatever order it registered its types in.
+     *
+     * @example
+     * ECS::WorldSnapshot before = world.Snapshot();
+     * simulate(world);
+     * world.Restore(before);   // rollback
+     */
+    class WorldSnapshot {
+    private:
+        /**
+         * @brief The serialized state
+         */
+        std::vector<unsigned char> m_data;
+
+        friend class World;
+
+    public:
+        /**
+         * @brief Value of the first four bytes of every snapshot ("ECSS")
+         */
+        static constexpr std::uint32_t MAGIC = 0x53534345u;
+
+        /**
+         * @brief Format version written by this build
+         */
+        static constexpr std::uint32_t VERSION = 2;
+
+        WorldSnapshot() = default;
+
+        /**
+         * @brief Wraps bytes previously obtained from GetData() (e.g. a dump read back from disk)
+         *
+         * The bytes are validated by World::Restore().
+         *
+         * @param data The serialized state
+         */
+        explicit WorldSnapshot(std::vector<unsigned char> data) : m_data(std::move(data)) {}
+
+        /**
+         * @brief Gets the serialized bytes
+         * @return const std::vector<unsigned char>& The buffer
+         */
+        const std::vector<unsigned char>& GetData() const { return m_data; }
+
+        /**
+         * @brief Gets the size of the buffer in bytes
+         * @return std::size_t Byte count
+         */
+        std::size_t Size() const { return m_data.size(); }
+
+        /**
+         * @brief Checks whether the snapshot holds nothing
+         * @return true if the buffer is empty
+         */
+        bool Empty() const { return m_data.empty(); }
+
+        /**
+         * @brief Gets the entity handles recorded in the snapshot
+         *
+         * World::Restore() returns the restored entities in the same order.
+         *
+         * @return std::vector<EntityID> Snapshot entities
+         * @throws std::runtime_error if the header is malformed
+         */
+        std::vector<EntityID> GetEntities() const;
+    };
+}
+
+#endif // ECS_SNAPSHOT_HPP
@@ -0,0 +1,198 @@
+/**
+ * @file SparseSet.h
+ * @brief Paged sparse set of entities used by component storage and groups
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the SparseSet class, the entity index shared by
+ * ComponentArray (which keeps its components parallel to the dense entity
+ * list) and by non-owning groups (which only track membership).
+ */
+
+#ifndef ECS_SPARSESET_HPP
+#define ECS_SPARSESET_HPP
+
+#include "Types.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief Set of entities with O(1) insert, lookup and removal
+     *
+     * Entities are stored packed in a dense vector; a paged sparse index maps
+     * an EntityID to its position in that vector. Removal is swap-and-pop, so
+     * the dense vector never has holes and can be scanned linearly.
+     *
+     * The sparse index is keyed by the slot index of the handle; the dense
+     * list keeps the full handle, so a stale handle (same index, older
+     * generation) is never reported as present.
+     *
+     * Pages of the sparse index are allocated lazily, so large or scattered
+     * entity IDs only cost memory for the pages actually touched.
+     */
+    class SparseSet {
+    public:
+        /**
+         * @brief Index value meaning "entity is not in the set"
+         */
+        static constexpr std::uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+    private:
+        /**
+         * @brief Number of sparse entries per page (power of two)
+         */
+        static constexpr std::size_t PAGE_SIZE = 4096;
+
+        using Page = std::array<std::uint32_t, PAGE_SIZE>;
+
+        /**
+         * @brief Packed list of the entities in the set
+         */
+        std::vector<EntityID> m_dense;
+
+        /**
+         * @brief Paged entity -> dense index
+         */
+        std::vector<std::unique_ptr<Page>> m_sparse;
+
+        /**
+         * @brief Gets the sparse entry of an entity, allocating its page if needed
+         *
+         * @param entity The EntityID to get the entry for
+         * @return std::uint32_t& Reference to the sparse entry
+         */
+        std::uint32_t& Entry(EntityID entity) {
+            const std::size_t page = GetEntityIndex(entity) / PAGE_SIZE;
+            if (page >= m_sparse.size()) {
+                m_sparse.resize(page + 1);
+            }
+            if (!m_sparse[page]) {
+                m_sparse[page] = std::make_unique<Page>();
+                m_sparse[page]->fill(NO_SLOT);
+            }
+            return (*m_sparse[page])[GetEntityIndex(entity) % PAGE_SIZE];
+        }
+
+    public:
+        /**
+         * @brief Gets the dense index of an entity
+         *
+         * @param entity The EntityID to look up
+         * @return std::uint32_t The dense index, or NO_SLOT if absent
+         */
+        std::uint32_t IndexOf(EntityID entity) const {
+            const std::size_t page = GetEntityIndex(entity) / PAGE_SIZE;
+            if (page >= m_sparse.size() || !m_sparse[page]) {
+                return NO_SLOT;
+            }
+            const std::uint32_t index = (*m_sparse[page])[GetEntityIndex(entity) % PAGE_SIZE];
+            return (index != NO_SLOT && m_dense[index] == entity) ? index : NO_SLOT;
+        }
+
+        /**
+         * @brief Checks whether an entity is in the set
+         *
+         * @param entity The EntityID to check
+         * @return true if present, false otherwise
+         */
+        bool Contains(EntityID entity) const {
+            return IndexOf(entity) != NO_SLOT;
+        }
+
+        /**
+         * @brief Appends an entity that is not yet in the set
+         *
+         * @param entity The EntityID to insert
+         * @return std::uint32_t The dense index of the entity
+         */
+        std::uint32_t Insert(EntityID entity) {
+            const std::uint32_t index = static_cast<std::uint32_t>(m_dense.size());
+            m_dense.push_back(entity);
+            Entry(entity) = index;
+            return index;
+        }
+
+        /**
+         * @brief Removes an entity from the set by swap-and-pop
+         *
+         * The last entity is moved into the freed index. Callers keeping data
+         * parallel to the dense list must perform the same move.
+         *
+         * @param entity The EntityID to remove (must be present)
+         * @return std::uint32_t The index that was freed (and now holds the former last entity)
+         */
+        std::uint32_t Remove(EntityID entity) {
+            const std::uint32_t index = IndexOf(entity);
+            const std::uint32_t last = static_cast<std::uint32_t>(m_dense.size() - 1);
+            if (index != last) {
+                m_dense[index] = m_dense[last];
+                Entry(m_dense[index]) = index;
+            }
+            m_dense.pop_back();
+            Entry(entity) = NO_SLOT;
+            return index;
+        }
+
+        /**
+         * @brief Swaps the entities stored at two dense indices
+         *
+         * @param a First dense index
+         * @param b Second dense index
+         */
+        void Swap(std::size_t a, std::size_t b) {
+            std::swap(m_dense[a], m_dense[b]);
+            Entry(m_dense[a]) = static_cast<std::uint32_t>(a);
+            Entry(m_dense[b]) = static_cast<std::uint32_t>(b);
+        }
+
+        /**
+         * @brief Gets the entity stored at a dense index
+         *
+         * @param index Dense index in [0, Size())
+         * @return EntityID The entity
+         */
+        EntityID At(std::size_t index) const { return m_dense[index]; }
+
+        /**
+         * @brief Gets the dense entity list
+         * @return const std::vector<EntityID>& Entities in dense order
+         */
+        const std::vector<EntityID>& Entities() const { return m_dense; }
+
+        /**
+         * @brief Gets the number of entities in the set
+         * @return std::size_t Entity count
+         */
+        std::size_t Size() const { return m_dense.size(); }
+
+        /**
+         * @brief Reserves dense capacity
+         *
+         * Grows at least geometrically, so repeated small reservations
+         * (batches of a few spawns) stay amortized O(1) per entity.
+         *
+         * @param capacity Number of entities to reserve room for
+         */
+        void Reserve(std::size_t capacity) {
+            if (capacity > m_dense.capacity()) {
+                m_dense.reserve(std::max(capacity, m_dense.capacity() * 2));
+            }
+        }
+
+        /**
+         * @brief Removes every entity and releases the sparse pages
+         */
+        void Clear() {
+            m_dense.clear();
+            m_sparse.clear();
+        }
+    };
+}
+
+#endif // ECS_SPARSESET_HPP
@@ -12,11 +12,15 @@
 #define ECS_SYSTEM_HPP
 
 #include "Types.h"
+#include "Component.h"
+#include "CommandBuffer.h"
+#include "Profiler.h"
 #include <string>
 
 namespace ECS {
-    // Forward declaration
+    // Forward declarations
     class World;
+    class SystemManager;
 
     /**
      * @brief Base class for all ECS systems
@@ -45,7 +49,128 @@ namespace ECS {
          */
         std::string m_name;
 
+        /**
+         * @brief Component types an entity needs to be processed by this system
+         */
+        Signature m_signature;
+
+        /**
+         * @brief Component types this system reads
+         */
+        Signature m_reads;
+
+        /**
+         * @brief Component types this system writes
+         */
+        Signature m_writes;
+
+        /**
+         * @brief Whether DeclareRead/DeclareWrite was called at least once
+         *
+         * Systems that never declare their access are exclusive: they never
+         * run alongside another system.
+         */
+        bool m_declaresAccess = false;
+
+        /**
+         * @brief Deferred commands recorded by this system while it runs
+         *
+         * Played back by the SystemManager in priority order, so the outcome
+         * does not depend on which worker ran the system.
+         */
+        CommandBuffer m_commandBuffer;
+
+        /**
+         * @brief Fixed update frequency in Hz, 0 to run once per UpdateSystems() call
+         */
+        float m_updateRate = 0.0f;
+
+        /**
+         * @brief Phase offset as a fraction of the period, AUTO_PHASE until the SystemManager picks one
+         */
+        float m_phase = 0.0f;
+
+        /**
+         * @brief Maximum number of fixed steps run in one UpdateSystems() call
+         */
+        unsigned m_maxSteps = 1;
+
+        /**
+         * @brief Time owed to the system, advanced by the SystemManager
+         */
+        float m_accumulator = 0.0f;
+
+        /**
+         * @brief Whether m_accumulator was seeded from the phase since the rate was set
+         */
+        bool m_scheduled = false;
+
+        /**
+         * @brief Number of fixed steps to run in the current UpdateSystems() call
+         */
+        unsigned m_pendingSteps = 0;
+
+#if ECS_PROFILING
+        /**
+         * @brief Wall time of the last runs of this system, recorded by the SystemManager
+         */
+        RollingHistogram m_timings;
+#endif
+
+        friend class SystemManager;
+
+    protected:
+        /**
+         * @brief Declares component types this system reads
+         *
+         * Together with DeclareWrite, lets the SystemManager run this system
+         * concurrently with systems it does not conflict with. A system that
+         * declares its access must not create/destroy entities or add/remove
+         * components directly; it records them in world.GetCommandBuffer().
+         *
+         * @tparam Ts The component types read
+         */
+        template<typename... Ts>
+        void DeclareRead() {
+            m_reads |= MakeSignature<Ts...>();
+            m_declaresAccess = true;
+        }
+
+        /**
+         * @brief Declares component types this system writes
+         *
+         * @tparam Ts The component types written
+         */
+        template<typename... Ts>
+        void DeclareWrite() {
+            m_writes |= MakeSignature<Ts...>();
+            m_declaresAccess = true;
+        }
+
+        /**
+         * @brief Declares component types this system requires
+         *
+         * Usually called from the derived constructor. Entities matching the
+         * resulting signature can be enumerated with World::EachEntity.
+         *
+         * @tparam Ts The required component types
+         */
+        template<typename... Ts>
+        void RequireComponents() {
+            m_signature |= MakeSignature<Ts...>();
+        }
+
     public:
+        /**
+         * @brief Phase value asking the SystemManager to pick a phase (see SetUpdateRate)
+         */
+        static constexpr float AUTO_PHASE = -1.0f;
+
+        /**
+         * @brief Default maximum number of catch-up steps per UpdateSystems() call
+         */
+        static constexpr unsigned DEFAULT_MAX_STEPS = 3;
+
         /**
          * @brief Construct a new System
          *
@@ -63,8 +188,9 @@ namespace ECS {
         /**
          * @brief Update the system logic
          *
-         * This method is called every frame when the system is enabled.
-         * Implement your system's logic here.
+         * This method is called every frame when the system is enabled, or
+         * at its fixed frequency (see SetUpdateRate). Implement your
+         * system's logic here.
          *
          * @param world Reference to the ECS world
          * @param deltaTime Time elapsed since last update in seconds
@@ -126,12 +252,94 @@ namespace ECS {
          */
         int GetPriority() const { return m_priority; }
 
+        /**
+         * @brief Runs the system at a fixed frequency instead of every frame
+         *
+         * The SystemManager accumulates the frame times and calls Update()
+         * with deltaTime = 1 / hz once per elapsed period, at most maxSteps
+         * times in one UpdateSystems() call; a larger backlog (after a stall)
+         * is dropped. Frames where the system is not due skip it entirely.
+         *
+         * The phase shifts the first run by phase * period, so systems of the
+         * same frequency can be spread over different frames. With AUTO_PHASE
+         * the SystemManager spreads them itself. Usually called from the
+         * derived constructor.
+         *
+         * @param hz Update frequency, 0 (or less) to run every frame
+         * @param phase Offset in [0, 1) of the period, or AUTO_PHASE
+         * @param maxSteps Maximum number of catch-up steps per frame, at least 1
+         */
+        void SetUpdateRate(float hz, float phase = AUTO_PHASE, unsigned maxSteps = DEFAULT_MAX_STEPS) {
+            m_updateRate = hz > 0.0f ? hz : 0.0f;
+            m_phase = phase;
+            m_maxSteps = maxSteps > 0 ? maxSteps : 1;
+            m_scheduled = false;
+        }
+
+        /**
+         * @brief Get the fixed update frequency
+         *
+         * @return Frequency in Hz, 0 if the system runs every frame
+         */
+        float GetUpdateRate() const { return m_updateRate; }
+
+        /**
+         * @brief Get the phase offset
+         *
+         * @return Fraction of the period, or AUTO_PHASE before the first update
+         */
+        float GetPhase() const { return m_phase; }
+
         /**
          * @brief Get the system's name
          *
          * @return System name
          */
         const std::string& GetName() const { return m_name; }
+
+        /**
+         * @brief Get the component signature required by this system
+         *
+         * @return Required signature (empty if the system declared none)
+         */
+        const Signature& GetSignature() const { return m_signature; }
+
+        /**
+         * @brief Get the component types this system reads
+         *
+         * @return Read signature
+         */
+        const Signature& GetReadSignature() const { return m_reads; }
+
+        /**
+         * @brief Get the component types this system writes
+         *
+         * @return Write signature
+         */
+        const Signature& GetWriteSignature() const { return m_writes; }
+
+        /**
+         * @brief Check whether this system declared its component access
+         *
+         * @return true if DeclareRead or DeclareWrite was called
+         */
+        bool HasDeclaredAccess() const { return m_declaresAccess; }
+
+        /**
+         * @brief Check whether this system may not run concurrently with another
+         *
+         * Two systems conflict when either one did not declare its access, or
+         * when one writes a component type the other reads or writes.
+         *
+         * @param other The other system
+         * @return true if the systems must run one after the other
+         */
+        bool ConflictsWith(const System& other) const {
+            if (!m_declaresAccess || !other.m_declaresAccess) {
+                return true;
+            }
+            return (m_writes & (other.m_reads | other.m_writes)).any() || (other.m_writes & m_reads).any();
+        }
     };
 }
 
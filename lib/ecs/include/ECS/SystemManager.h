@@ -13,7 +13,11 @@
 
 #include "System.h"
 #include "Types.h"
+#include "Profiler.h"
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -51,11 +55,95 @@ namespace ECS {
          */
         bool m_needsSort = false;
 
+        /**
+         * @brief Enabled systems grouped in stages, rebuilt every update
+         *
+         * Systems of a stage do not conflict with each other and run
+         * concurrently. Only the first m_stageCount entries are in use; the
+         * others keep their capacity for the next frames.
+         */
+        std::vector<std::vector<System*>> m_stages;
+
+        /**
+         * @brief Number of stages in use in m_stages
+         */
+        size_t m_stageCount = 0;
+
+        /**
+         * @brief Stage index of each enabled system, scratch for BuildStages()
+         */
+        std::vector<std::pair<System*, size_t>> m_levels;
+
+        /**
+         * @brief Tasks handed to the thread pool, scratch for UpdateSystems()
+         */
+        std::vector<std::function<void()>> m_tasks;
+
+        /**
+         * @brief Phase handed to the next fixed-rate system asking for AUTO_PHASE
+         */
+        float m_nextAutoPhase = 0.0f;
+
+#if ECS_PROFILING
+        /**
+         * @brief Wall time of the last UpdateSystems() calls
+         */
+        RollingHistogram m_tickTimes;
+
+        /**
+         * @brief Number of UpdateSystems() calls so far
+         */
+        std::uint64_t m_frame = 0;
+
+        /**
+         * @brief Frames between two calls of m_dumpSink, 0 when dumps are off
+         */
+        std::uint64_t m_dumpInterval = 0;
+
+        /**
+         * @brief Receives a report every m_dumpInterval frames
+         */
+        std::function<void(const ProfileReport&)> m_dumpSink;
+#endif
+
         /**
          * @brief Sort systems by priority (lower priority executes first)
          */
         void SortSystems();
 
+        /**
+         * @brief Groups the enabled systems in stages
+         *
+         * A system is placed one stage after the last earlier (in priority
+         * order) system it conflicts with, so conflicting systems keep their
+         * priority order and everything else is packed as early as possible.
+         */
+        void BuildStages();
+
+        /**
+         * @brief Advances the accumulator of a system and counts its steps due this frame
+         *
+         * Systems without a fixed rate get one step. Seeds the accumulator
+         * from the phase (picking one for AUTO_PHASE) the first time.
+         *
+         * @param system The enabled system
+         * @param deltaTime Time elapsed since last update in seconds
+         * @return unsigned Number of Update() calls to make, at most the system's maxSteps
+         */
+        unsigned ScheduleSteps(System& system, float deltaTime);
+
+        /**
+         * @brief Runs a system with its command buffer bound to the calling thread
+         *
+         * Calls Update() once per pending step, with the fixed period as
+         * delta for fixed-rate systems.
+         *
+         * @param world Reference to the ECS world
+         * @param system The system to run
+         * @param deltaTime Time elapsed since last update in seconds
+         */
+        void RunSystem(World& world, System& system, float deltaTime);
+
     public:
         /**
          * @brief Default constructor
@@ -178,8 +266,19 @@ namespace ECS {
         /**
          * @brief Update all enabled systems
          *
-         * Calls the Update method on all enabled systems in priority order.
-         * Systems with lower priority values are updated first.
+         * Calls the Update method on all enabled systems. Systems that declared
+         * their component access and do not conflict run concurrently on the
+         * world's thread pool; conflicting systems, and every system that did
+         * not declare its access, run in priority order (lower values first).
+         *
+         * Fixed-rate systems (System::SetUpdateRate) run zero, one or a few
+         * times depending on the time they accumulated; systems that are not
+         * due this frame take no part in the stages.
+         *
+         * Each group of concurrent systems (a stage) ends with a sync point:
+         * the systems' deferred commands are played back in priority order,
+         * then the world's, so the next stage sees the structural changes of
+         * the previous one. Undeclared systems are alone in their stage.
          *
          * @param world Reference to the ECS world
          * @param deltaTime Time elapsed since last update in seconds
@@ -198,6 +297,19 @@ namespace ECS {
          */
         bool SetSystemPriority(const std::string& systemName, int priority);
 
+        /**
+         * @brief Set the fixed update frequency of a system
+         *
+         * @param systemName Name of the system
+         * @param hz Update frequency, 0 to run every frame
+         * @param phase Offset in [0, 1) of the period, or System::AUTO_PHASE
+         * @param maxSteps Maximum number of catch-up steps per frame
+         * @return true if system was found and its rate was set, false otherwise
+         * @see System::SetUpdateRate
+         */
+        bool SetSystemRate(const std::string& systemName, float hz, float phase = System::AUTO_PHASE,
+                           unsigned maxSteps = System::DEFAULT_MAX_STEPS);
+
         /**
          * @brief Get the number of registered systems
          *
@@ -221,6 +333,27 @@ namespace ECS {
          * @param world Reference to the ECS world
          */
         void Clear(World& world);
+
+        /**
+         * @brief Fills the tick and per-system timings of a report
+         *
+         * Leaves the report untouched when built with ECS_PROFILING=0. Call
+         * it between two UpdateSystems() calls.
+         *
+         * @param report The report to fill
+         */
+        void GetTimings(ProfileReport& report) const;
+
+        /**
+         * @brief Hands a report to a function every few frames
+         *
+         * The function runs on the thread calling UpdateSystems(), at the end
+         * of the update. Ignored when built with ECS_PROFILING=0.
+         *
+         * @param everyFrames Frames between two reports, 0 to stop
+         * @param sink Function receiving the reports
+         */
+        void SetProfileDump(std::uint64_t everyFrames, std::function<void(const ProfileReport&)> sink);
     };
 }
 
@@ -0,0 +1,156 @@
+/**
+ * @file Tag.h
+ * @brief Bitset storage for tag components and categorical partitions
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains EntityBitset, a dense bitset indexed by entity slot.
+ * It stores tag components (empty marker types, see World::AddTag) and the
+ * categories of a ComponentPartition: membership is one bit, no component
+ * is allocated, and visiting the members is a scan of 64-bit words.
+ */
+
+#ifndef ECS_TAG_HPP
+#define ECS_TAG_HPP
+
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace ECS {
+    /**
+     * @brief Whether a component type is a tag: an empty type stored as one bit per entity
+     *
+     * @tparam T The component type
+     */
+    template<typename T>
+    inline constexpr bool IS_TAG_COMPONENT = std::is_empty_v<T>;
+
+    /**
+     * @brief Gets the index of the lowest set bit of a non-zero word
+     *
+     * @param word The word (must not be 0)
+     * @return std::uint32_t Bit index, 0 to 63
+     */
+    inline std::uint32_t CountTrailingZeros(std::uint64_t word) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<std::uint32_t>(index);
+#else
+        return static_cast<std::uint32_t>(__builtin_ctzll(word));
+#endif
+    }
+
+    /**
+     * @brief Set of entity slot indices, one bit per slot
+     *
+     * Stores slot indices, not handles: the owner maps set bits back to
+     * live handles and clears the bits of destroyed entities.
+     */
+    class EntityBitset {
+    private:
+        /**
+         * @brief Bits, 64 slots per word
+         */
+        std::vector<std::uint64_t> m_words;
+
+        /**
+         * @brief Number of set bits
+         */
+        std::size_t m_count = 0;
+
+    public:
+        /**
+         * @brief Adds a slot to the set
+         *
+         * @param index The entity slot index
+         * @return true if the slot was not in the set
+         */
+        bool Set(std::uint32_t index) {
+            const std::size_t word = index / 64;
+            if (word >= m_words.size()) {
+                m_words.resize(word + 1, 0);
+            }
+            const std::uint64_t bit = std::uint64_t{1} << (index % 64);
+            if (m_words[word] & bit) {
+                return false;
+            }
+            m_words[word] |= bit;
+            ++m_count;
+            return true;
+        }
+
+        /**
+         * @brief Removes a slot from the set
+         *
+         * @param index The entity slot index
+         * @return true if the slot was in the set
+         */
+        bool Reset(std::uint32_t index) {
+            if (!Test(index)) {
+                return false;
+            }
+            m_words[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+            --m_count;
+            return true;
+        }
+
+        /**
+         * @brief Checks whether a slot is in the set
+         *
+         * @param index The entity slot index
+         * @return true if the bit is set
+         */
+        bool Test(std::uint32_t index) const {
+            const std::size_t word = index / 64;
+            return word < m_words.size() && (m_words[word] >> (index % 64)) & 1u;
+        }
+
+        /**
+         * @brief Gets the number of slots in the set
+         * @return std::size_t Set bit count
+         */
+        std::size_t Count() const { return m_count; }
+
+        /**
+         * @brief Empties the set
+         */
+        void Clear() {
+            m_words.clear();
+            m_count = 0;
+        }
+
+        /**
+         * @brief Calls a function for every slot in the set, in ascending order
+         *
+         * Bits are re-tested before each call, so the function may remove
+         * slots, including ones not visited yet; slots added during the
+         * scan may or may not be visited.
+         *
+         * @tparam Func Callable taking a std::uint32_t slot index
+         * @param func Function to call
+         */
+        template<typename Func>
+        void ForEach(Func&& func) const {
+            for (std::size_t word = 0; word < m_words.size(); ++word) {
+                std::uint64_t bits = m_words[word];
+                while (bits != 0) {
+                    const std::uint32_t index = static_cast<std::uint32_t>(word * 64) + CountTrailingZeros(bits);
+                    bits &= bits - 1;
+                    if (Test(index)) {
+                        func(index);
+                    }
+                }
+            }
+        }
+    };
+}
+
+#endif // ECS_TAG_HPP
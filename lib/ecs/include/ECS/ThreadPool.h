@@ -0,0 +1,208 @@
+/**
+ * @file ThreadPool.h
+ * @brief Work-stealing worker pool used by the ECS scheduler and parallel iteration
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the ThreadPool class, a fixed set of worker threads that
+ * execute batches of tasks. Each worker owns a task deque and steals from the
+ * others when it runs dry. The thread submitting a batch takes part in its
+ * execution and returns once every task of the batch has finished.
+ */
+
+#ifndef ECS_THREADPOOL_HPP
+#define ECS_THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief Fixed set of worker threads running batches of tasks
+     *
+     * Every worker has its own deque: it pops its newest task first and,
+     * when empty, steals the oldest task of another worker. Batches submitted
+     * from outside the pool are spread round-robin over the workers; batches
+     * submitted from a task (nested parallelism) go to the submitting
+     * worker's deque, where they stay hot in its cache unless someone idles.
+     *
+     * Run() blocks until the whole batch is done, and the calling thread
+     * executes tasks too, so a pool with zero workers simply runs the batch
+     * serially and a task may itself call Run() without deadlocking.
+     */
+    class ThreadPool {
+    public:
+        /**
+         * @brief Default number of elements per chunk for ParallelFor
+         */
+        static constexpr std::size_t DEFAULT_GRAIN_SIZE = 256;
+
+    private:
+        /**
+         * @brief Completion state shared by the tasks of one Run() call
+         */
+        struct Batch {
+            std::atomic<std::size_t> remaining{0};
+            std::exception_ptr error;
+        };
+
+        /**
+         * @brief A queued task and the batch it belongs to
+         */
+        struct Task {
+            const std::function<void()>* function = nullptr;
+            Batch* batch = nullptr;
+        };
+
+        /**
+         * @brief Task deque of one worker
+         */
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /**
+         * @brief Worker threads
+         */
+        std::vector<std::thread> m_workers;
+
+        /**
+         * @brief One deque per worker, same index as m_workers
+         */
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+        /**
+         * @brief Number of queued tasks, all deques included
+         */
+        std::atomic<std::size_t> m_pending{0};
+
+        /**
+         * @brief Next deque receiving a task submitted from outside the pool
+         */
+        std::atomic<std::size_t> m_nextQueue{0};
+
+        /**
+         * @brief Protects sleeping/waking, batch errors and m_stopping
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief Signaled when tasks are queued, a batch completes or the pool stops
+         */
+        std::condition_variable m_wake;
+
+        /**
+         * @brief Set by the destructor to stop the workers
+         */
+        bool m_stopping = false;
+
+        /**
+         * @brief Worker thread main loop
+         *
+         * @param index Index of the worker's own deque
+         */
+        void WorkerLoop(std::size_t index);
+
+        /**
+         * @brief Pops a task from the given deque, or steals one from another
+         *
+         * @param home Deque tried first (from its back); others are robbed from their front
+         * @param task Receives the task
+         * @return true if a task was found
+         */
+        bool FindTask(std::size_t home, Task& task);
+
+        /**
+         * @brief Executes a task and records its completion
+         *
+         * @param task The task to execute
+         */
+        void Execute(const Task& task);
+
+        /**
+         * @brief Gets the deque index of the calling thread
+         *
+         * @return std::size_t Its own deque for a worker of this pool, a round-robin pick otherwise
+         */
+        std::size_t HomeQueue();
+
+    public:
+        /**
+         * @brief Starts the worker threads
+         *
+         * @param workerCount Number of threads to start besides the caller of Run()
+         */
+        explicit ThreadPool(std::size_t workerCount);
+
+        /**
+         * @brief Stops and joins the worker threads
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Gets the number of worker threads
+         * @return std::size_t Worker count (the calling thread is not included)
+         */
+        std::size_t GetWorkerCount() const { return m_workers.size(); }
+
+        /**
+         * @brief Runs a batch of tasks and waits for all of them
+         *
+         * @param tasks The tasks; they must stay alive until Run() returns
+         * @throws Rethrows the first exception thrown by a task, after the whole batch finished
+         */
+        void Run(const std::vector<std::function<void()>>& tasks);
+
+        /**
+         * @brief Splits [0, count) into chunks and processes them in parallel
+         *
+         * Runs func(0, count) on the calling thread when the pool has no
+         * worker or when count does not exceed the grain size.
+         *
+         * @tparam Func Callable taking (std::size_t begin, std::size_t end)
+         * @param count Number of elements
+         * @param grainSize Maximum number of elements per chunk (0 is treated as 1)
+         * @param func Function called once per chunk
+         */
+        template<typename Func>
+        void ParallelFor(std::size_t count, std::size_t grainSize, Func&& func) {
+            grainSize = std::max<std::size_t>(grainSize, 1);
+            if (count == 0) {
+                return;
+            }
+            if (m_workers.empty() || count <= grainSize) {
+                func(std::size_t{0}, count);
+                return;
+            }
+
+            std::vector<std::function<void()>> chunks;
+            chunks.reserve((count + grainSize - 1) / grainSize);
+            for (std::size_t begin = 0; begin < count; begin += grainSize) {
+                const std::size_t end = std::min(begin + grainSize, count);
+                chunks.emplace_back([&func, begin, end]() { func(begin, end); });
+            }
+            Run(chunks);
+        }
+
+        /**
+         * @brief Default number of workers for this machine
+         * @return std::size_t hardware_concurrency() - 1, at least 0
+         */
+        static std::size_t DefaultWorkerCount();
+    };
+}
+
+#endif // ECS_THREADPOOL_HPP
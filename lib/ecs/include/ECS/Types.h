@@ -11,17 +11,72 @@
 #ifndef ECS_TYPES_HPP
 #define ECS_TYPES_HPP
 
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
 
 namespace ECS {
     /**
      * @brief Type alias for entity identifiers
      *
-     * EntityID is used to uniquely identify entities within the ECS world.
-     * Uses a 32-bit unsigned integer to support up to ~4 billion entities.
+     * EntityID is a 32-bit handle packing a slot index (low ENTITY_INDEX_BITS)
+     * and a generation (high ENTITY_GENERATION_BITS). The generation is bumped
+     * every time a slot is freed, so a handle kept after its entity was
+     * destroyed never aliases the entity that reuses the slot.
      */
     using EntityID = std::uint32_t;
 
+    /**
+     * @brief Number of handle bits used for the slot index (~1M live entities)
+     */
+    constexpr std::uint32_t ENTITY_INDEX_BITS = 20;
+
+    /**
+     * @brief Number of handle bits used for the generation
+     */
+    constexpr std::uint32_t ENTITY_GENERATION_BITS = 32 - ENTITY_INDEX_BITS;
+
+    /**
+     * @brief Mask extracting the slot index from a handle
+     */
+    constexpr std::uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+
+    /**
+     * @brief Mask of a generation value (before shifting)
+     */
+    constexpr std::uint32_t ENTITY_GENERATION_MASK = (1u << ENTITY_GENERATION_BITS) - 1;
+
+    /**
+     * @brief Builds an entity handle from a slot index and a generation
+     *
+     * @param index Slot index, lower than 2^ENTITY_INDEX_BITS
+     * @param generation Generation, wrapped to ENTITY_GENERATION_BITS
+     * @return EntityID The packed handle
+     */
+    constexpr EntityID MakeEntity(std::uint32_t index, std::uint32_t generation) {
+        return ((generation & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+    }
+
+    /**
+     * @brief Extracts the slot index of an entity handle
+     *
+     * @param entity The entity handle
+     * @return std::uint32_t The slot index
+     */
+    constexpr std::uint32_t GetEntityIndex(EntityID entity) {
+        return entity & ENTITY_INDEX_MASK;
+    }
+
+    /**
+     * @brief Extracts the generation of an entity handle
+     *
+     * @param entity The entity handle
+     * @return std::uint32_t The generation
+     */
+    constexpr std::uint32_t GetEntityGeneration(EntityID entity) {
+        return entity >> ENTITY_INDEX_BITS;
+    }
+
     /**
      * @brief Type alias for component type identifiers
      *
@@ -30,11 +85,37 @@ namespace ECS {
      */
     using ComponentTypeID = std::uint32_t;
 
+    /**
+     * @brief Maximum number of distinct component types per program
+     *
+     * Component type IDs are dense, starting at 1, and must stay below this
+     * value so that they can index a Signature bit.
+     */
+    constexpr std::size_t MAX_COMPONENT_TYPES = 64;
+
+    /**
+     * @brief Set of component types, one bit per ComponentTypeID
+     *
+     * Each entity has a signature listing the components it owns; systems and
+     * queries describe what they need with the same type, so matching is
+     * (entitySignature & required) == required.
+     */
+    using Signature = std::bitset<MAX_COMPONENT_TYPES>;
+
+    /**
+     * @brief Change-tracking clock value
+     *
+     * The World's tick only moves forward (see World::AdvanceTick); tracked
+     * components remember the tick of their last modification. 64 bits, so
+     * it never wraps in practice.
+     */
+    using Tick = std::uint64_t;
+
     /**
      * @brief Constant representing an invalid/null entity
      *
      * This constant is used to represent an invalid entity ID.
-     * Entity ID 0 is reserved and should never be assigned to a valid entity.
+     * Slot index 0 is reserved, so handle 0 is never assigned to a valid entity.
      */
     constexpr EntityID INVALID_ENTITY = 0;
 }
@@ -0,0 +1,258 @@
+/**
+ * @file View.h
+ * @brief Multi-component views over the ECS component storage
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file contains the ComponentView class, which iterates every entity that
+ * owns a given set of components (and none of an optional exclusion set).
+ * Views are cheap, non-owning objects obtained through World::View().
+ */
+
+#ifndef ECS_VIEW_HPP
+#define ECS_VIEW_HPP
+
+#include "Types.h"
+#include "ComponentManager.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+    /**
+     * @brief Tag listing component types an entity must NOT own to match a view
+     *
+     * @tparam Ts The excluded component types
+     *
+     * @example
+     * world.View<Position, Velocity>(ECS::Exclude<Player>{})
+     */
+    template<typename... Ts>
+    struct Exclude {};
+
+    /**
+     * @brief Primary template, only the Exclude<> specialization is defined
+     */
+    template<typename Exclusions, typename... Ts>
+    class ComponentView;
+
+    /**
+     * @brief Iterates entities owning all of Ts... and none of Ex...
+     *
+     * The view drives iteration from the smallest of its component pools and
+     * tests membership in the other pools through their sparse index (two array
+     * reads per pool, no hashing). It can be consumed either with Each() or
+     * with a range-for loop yielding (EntityID, Ts&...) tuples:
+     *
+     * @code
+     * world.View<Position, Velocity>().Each([](ECS::EntityID e, Position& p, Velocity& v) { ... });
+     *
+     * for (auto [entity, pos, vel] : world.View<Position, Velocity>()) { ... }
+     * @endcode
+     *
+     * Like component array iteration, a view is index based: adding components
+     * while iterating is safe, and removing entities while iterating never goes
+     * out of bounds, but component references are only valid until the next
+     * structural change of their pool.
+     *
+     * @tparam Ex Excluded component types
+     * @tparam Ts Required component types
+     */
+    template<typename... Ex, typename... Ts>
+    class ComponentView<Exclude<Ex...>, Ts...> {
+        static_assert(sizeof...(Ts) > 0, "A view needs at least one component type");
+
+    private:
+        /**
+         * @brief Pools of the required components
+         */
+        std::tuple<ComponentArray<Ts>*...> m_pools;
+
+        /**
+         * @brief Pools of the excluded components
+         */
+        std::tuple<ComponentArray<Ex>*...> m_excluded;
+
+        /**
+         * @brief Dense entity list of the smallest required pool
+         */
+        const std::vector<EntityID>* m_lead = nullptr;
+
+        /**
+         * @brief Selects the smallest required pool as the iteration driver
+         */
+        void SelectLead() {
+            std::size_t best = static_cast<std::size_t>(-1);
+            std::apply([this, &best](auto*... pools) {
+                ((pools->Size() < best ? (best = pools->Size(), m_lead = &pools->Entities(), 0) : 0), ...);
+            }, m_pools);
+        }
+
+        /**
+         * @brief Builds the tuple of component references for an entity
+         *
+         * @param entity An entity for which Contains() is true
+         * @return std::tuple<EntityID, Ts&...> The entity and its components
+         */
+        std::tuple<EntityID, Ts&...> Fetch(EntityID entity) const {
+            return std::tuple<EntityID, Ts&...>(entity, *std::get<ComponentArray<Ts>*>(m_pools)->GetComponent(entity)...);
+        }
+
+        /**
+         * @brief Calls a function for the matching entities among a range of driving pool slots
+         *
+         * @param begin First slot of the driving pool
+         * @param end Slot past the last one
+         * @param func Function to call
+         */
+        template<typename Func>
+        void EachInRange(std::size_t begin, std::size_t end, Func& func) const {
+            for (std::size_t i = begin; i < end && i < m_lead->size(); ++i) {
+                const EntityID entity = (*m_lead)[i];
+                if (!Contains(entity)) {
+                    continue;
+                }
+                if constexpr (std::is_invocable_v<Func&, EntityID, Ts&...>) {
+                    func(entity, *std::get<ComponentArray<Ts>*>(m_pools)->GetComponent(entity)...);
+                } else {
+                    func(*std::get<ComponentArray<Ts>*>(m_pools)->GetComponent(entity)...);
+                }
+            }
+        }
+
+        /**
+         * @brief Forward iterator over matching entities
+         */
+        class Iterator {
+        private:
+            const ComponentView* m_view = nullptr;
+            std::size_t m_index = 0;
+
+            bool AtEnd() const {
+                return !m_view || m_index >= m_view->m_lead->size();
+            }
+
+            void Seek() {
+                while (!AtEnd() && !m_view->Contains((*m_view->m_lead)[m_index])) {
+                    ++m_index;
+                }
+            }
+
+        public:
+            using value_type = std::tuple<EntityID, Ts&...>;
+            using reference = value_type;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+
+            Iterator() = default;
+
+            Iterator(const ComponentView* view, std::size_t index) : m_view(view), m_index(index) {
+                Seek();
+            }
+
+            value_type operator*() const {
+                return m_view->Fetch((*m_view->m_lead)[m_index]);
+            }
+
+            Iterator& operator++() {
+                ++m_index;
+                Seek();
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const {
+                if (AtEnd() || other.AtEnd()) {
+                    return AtEnd() && other.AtEnd();
+                }
+                return m_index == other.m_index;
+            }
+
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+        };
+
+    public:
+        using iterator = Iterator;
+
+        /**
+         * @brief Constructs a view over the given pools
+         *
+         * @param pools The required component pools
+         * @param excluded The excluded component pools
+         */
+        ComponentView(std::tuple<ComponentArray<Ts>*...> pools, std::tuple<ComponentArray<Ex>*...> excluded)
+            : m_pools(pools), m_excluded(excluded) {
+            SelectLead();
+        }
+
+        /**
+         * @brief Checks whether an entity matches the view
+         *
+         * @param entity The EntityID to test
+         * @return true if the entity owns all required and no excluded component
+         */
+        bool Contains(EntityID entity) const {
+            return std::apply([entity](auto*... pools) { return (pools->HasComponent(entity) && ...); }, m_pools)
+                && std::apply([entity](auto*... pools) { return !(pools->HasComponent(entity) || ...); }, m_excluded);
+        }
+
+        /**
+         * @brief Upper bound of the number of matching entities
+         *
+         * @return std::size_t Size of the smallest required pool
+         */
+        std::size_t SizeHint() const { return m_lead->size(); }
+
+        /**
+         * @brief Calls a function for every matching entity
+         *
+         * The function may take either (EntityID, Ts&...) or (Ts&...).
+         *
+         * @tparam Func Callable type
+         * @param func Function to call
+         */
+        template<typename Func>
+        void Each(Func&& func) const {
+            EachInRange(0, m_lead->size(), func);
+        }
+
+        /**
+         * @brief Calls a function for every matching entity, from several threads
+         *
+         * Splits the driving pool into chunks of grainSize entries processed
+         * on the given pool. Each entity is visited exactly once, on an
+         * unspecified thread. The function must not make structural changes
+         * (record them in the calling thread's world.GetCommandBuffer()) nor
+         * write components of other entities.
+         *
+         * @tparam Func Callable type, taking (EntityID, Ts&...) or (Ts&...)
+         * @param pool The pool running the chunks
+         * @param func Function to call, concurrently
+         * @param grainSize Maximum number of entries per chunk
+         */
+        template<typename Func>
+        void ParallelEach(ThreadPool& pool, Func&& func, std::size_t grainSize = ThreadPool::DEFAULT_GRAIN_SIZE) const {
+            pool.ParallelFor(m_lead->size(), grainSize, [this, &func](std::size_t begin, std::size_t end) {
+                EachInRange(begin, end, func);
+            });
+        }
+
+        /**
+         * @brief Returns iterator to the first matching entity
+         * @return Iterator to the first match
+         */
+        iterator begin() const { return iterator(this, 0); }
+
+        /**
+         * @brief Returns iterator past the last matching entity
+         * @return End iterator
+         */
+        iterator end() const { return iterator(this, m_lead->size()); }
+    };
+}
+
+#endif // ECS_VIEW_HPP
@@ -14,8 +14,14 @@
 
 #include "Types.h"
 #include "EntityManager.h"
+#include "Hierarchy.h"
 #include "ComponentManager.h"
 #include "SystemManager.h"
+#include "CommandBuffer.h"
+#include "Snapshot.h"
+#include "Prefab.h"
+#include "ThreadPool.h"
+#include "View.h"
 
 namespace ECS {
     /**
@@ -41,11 +47,38 @@ namespace ECS {
          */
         ComponentManager m_componentManager;
 
+        /**
+         * @brief Parent/children links between entities
+         */
+        Hierarchy m_hierarchy;
+
         /**
          * @brief Manages system registration, execution, and lifecycle
          */
         SystemManager m_systemManager;
 
+        /**
+         * @brief Per-thread buffers of deferred structural changes
+         */
+        CommandQueue m_commands;
+
+        /**
+         * @brief Workers running concurrent systems and ParallelEach chunks, created on first use
+         */
+        std::unique_ptr<ThreadPool> m_threadPool;
+
+        /**
+         * @brief Number of workers the thread pool is created with
+         */
+        std::size_t m_workerCount = ThreadPool::DefaultWorkerCount();
+
+        /**
+         * @brief Protects the lazy creation of m_threadPool
+         */
+        std::mutex m_threadPoolMutex;
+
+        friend class SystemManager;
+
     public:
         /**
          * @brief Default constructor
@@ -68,10 +101,54 @@ namespace ECS {
          */
         EntityID CreateEntity();
 
+        /**
+         * @brief Creates a batch of entities from a prefab
+         *
+         * Allocates the entities in one go, then copies each prototype
+         * component onto the whole batch (one storage reservation per type,
+         * groups and OnConstruct listeners notified as usual), then calls
+         * init on every entity. Listeners therefore see the prefab values:
+         * fields that indexes or partitions key on should be set in the
+         * prefab, or changed in init through ModifyComponent().
+         *
+         * @tparam Init Callable taking (EntityID entity, std::size_t index in the batch)
+         * @param prefab The template to copy
+         * @param count Number of entities to create
+         * @param init Per-entity initialization (positions, owners, ...)
+         * @return std::vector<EntityID> The new entities, in batch order
+         *
+         * @example
+         * world.Instantiate(pellet, 5, [&](ECS::EntityID e, std::size_t i) {
+         *     world.GetComponent<Velocity>(e)->vy = spread * (static_cast<float>(i) - 2.0f);
+         * });
+         */
+        template<typename Init>
+        std::vector<EntityID> Instantiate(const Prefab& prefab, std::size_t count, Init&& init) {
+            std::vector<EntityID> entities = m_entityManager.CreateEntities(count);
+            prefab.Apply(m_componentManager, entities);
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                init(entities[i], i);
+            }
+            return entities;
+        }
+
+        /**
+         * @brief Creates a batch of identical entities from a prefab
+         *
+         * @param prefab The template to copy
+         * @param count Number of entities to create
+         * @return std::vector<EntityID> The new entities
+         */
+        std::vector<EntityID> Instantiate(const Prefab& prefab, std::size_t count = 1) {
+            return Instantiate(prefab, count, [](EntityID, std::size_t) {});
+        }
+
         /**
          * @brief Destroys an entity and all its components
          *
          * Removes the entity from the world and cleans up all associated components.
+         * Children attached with destroyWithParent are destroyed first (recursively),
+         * the other children become roots.
          *
          * @param entity The EntityID of the entity to destroy
          */
@@ -93,13 +170,96 @@ namespace ECS {
         size_t GetAliveEntityCount() const;
 
         /**
-         * @brief Get a vector of all currently alive entities.
-         * @return Vector of EntityID representing all alive entities.
+         * @brief Get the packed list of all currently alive entities.
+         *
+         * No allocation or scan: this is the EntityManager's own alive list.
+         * Copy it first if entities are created or destroyed while iterating.
+         *
+         * @return Reference to the alive entity handles.
          */
-        std::vector<EntityID> GetAllEntities() const {
+        const std::vector<EntityID>& GetAllEntities() const {
             return m_entityManager.GetAllEntities();
         }
 
+        // Hierarchy
+
+        /**
+         * @brief Makes an entity a child of another
+         *
+         * An entity has at most one parent: a previous parent is replaced.
+         *
+         * @param child The child entity
+         * @param parent The parent entity
+         * @param destroyWithParent Whether destroying the parent destroys the child too
+         * @return false if either entity is dead, they are the same, or child is an
+         *         ancestor of parent (which would create a cycle)
+         *
+         * @example
+         * world.SetParent(enemy, room, true);   // room teardown destroys the enemy
+         */
+        bool SetParent(EntityID child, EntityID parent, bool destroyWithParent = false);
+
+        /**
+         * @brief Detaches an entity from its parent
+         *
+         * @param child The entity to make a root
+         */
+        void RemoveParent(EntityID child) {
+            if (IsEntityAlive(child)) {
+                m_hierarchy.Detach(child);
+            }
+        }
+
+        /**
+         * @brief Gets the parent of an entity
+         *
+         * @param child The entity
+         * @return EntityID The parent, or INVALID_ENTITY for a root or a dead entity
+         */
+        EntityID GetParent(EntityID child) const {
+            return IsEntityAlive(child) ? m_hierarchy.GetParent(child) : INVALID_ENTITY;
+        }
+
+        /**
+         * @brief Gets the number of children of an entity
+         *
+         * @param parent The entity
+         * @return std::size_t Child count (0 for a dead entity)
+         */
+        std::size_t GetChildCount(EntityID parent) const {
+            return IsEntityAlive(parent) ? m_hierarchy.GetChildCount(parent) : 0;
+        }
+
+        /**
+         * @brief Calls a function for every child of an entity, in attachment order
+         *
+         * O(children). The function may detach the child it is given; record
+         * destructions in the command buffer.
+         *
+         * @tparam Func Callable taking an EntityID
+         * @param parent The entity whose children are visited
+         * @param func Function to call
+         */
+        template<typename Func>
+        void EachChild(EntityID parent, Func&& func) const {
+            if (IsEntityAlive(parent)) {
+                m_hierarchy.EachChild(parent, std::forward<Func>(func));
+            }
+        }
+
+        /**
+         * @brief Gets the children of an entity
+         *
+         * @param parent The entity
+         * @return std::vector<EntityID> The children, in attachment order
+         */
+        std::vector<EntityID> GetChildren(EntityID parent) const {
+            std::vector<EntityID> children;
+            children.reserve(GetChildCount(parent));
+            EachChild(parent, [&children](EntityID child) { children.push_back(child); });
+            return children;
+        }
+
         // Component Management
 
         /**
@@ -112,10 +272,13 @@ namespace ECS {
          * @tparam Args The argument types for the component constructor
          * @param entity The EntityID to add the component to
          * @param args Arguments to forward to the component constructor
-         * @return T* Pointer to the newly created component
+         * @return T* Pointer to the newly created component, or nullptr if the entity is not alive
          */
         template<typename T, typename... Args>
         T* AddComponent(EntityID entity, Args&&... args) {
+            if (!m_entityManager.IsEntityAlive(entity)) {
+                return nullptr;
+            }
             return m_componentManager.AddComponent<T>(entity, std::forward<Args>(args)...);
         }
 
@@ -131,6 +294,148 @@ namespace ECS {
             return m_componentManager.GetComponent<T>(entity);
         }
 
+        // Change Tracking
+
+        /**
+         * @brief Starts recording when components of type T change
+         *
+         * Opt-in per type: untracked types pay nothing. Once enabled, adding
+         * or replacing a component and ModifyComponent()/MarkChanged() stamp
+         * it with the current tick.
+         *
+         * @tparam T The component type to track
+         */
+        template<typename T>
+        void EnableChangeTracking() {
+            m_componentManager.EnableChangeTracking<T>();
+        }
+
+        /**
+         * @brief Retrieves a component for writing, recording the modification
+         *
+         * @tparam T The component type to retrieve
+         * @param entity The EntityID to get the component from
+         * @return T* Pointer to the component, or nullptr if not found
+         *
+         * @example
+         * if (auto* health = world.ModifyComponent<Health>(player)) health->currentHp -= damage;
+         */
+        template<typename T>
+        T* ModifyComponent(EntityID entity) {
+            return m_componentManager.ModifyComponent<T>(entity);
+        }
+
+        /**
+         * @brief Records that an entity's component of type T was modified
+         *
+         * For writes done through GetComponent() or iteration. Fires
+         * OnUpdate<T> like ModifyComponent().
+         *
+         * @tparam T The component type
+         * @param entity The EntityID whose component changed
+         */
+        template<typename T>
+        void MarkChanged(EntityID entity) {
+            m_componentManager.ModifyComponent<T>(entity);
+        }
+
+        /**
+         * @brief Calls a function for every component of type T changed at or after a tick
+         *
+         * @tparam T The component type (visits everything if it is not tracked)
+         * @tparam Func Callable taking (EntityID, T&)
+         * @param since First tick of interest
+         * @param func Function to call
+         *
+         * @example
+         * ECS::Tick since = m_lastSync;
+         * m_lastSync = world.AdvanceTick();
+         * world.EachChanged<Position>(since, [&](ECS::EntityID e, Position& pos) { replicate(e, pos); });
+         */
+        template<typename T, typename Func>
+        void EachChanged(Tick since, Func&& func) {
+            m_componentManager.GetAllComponents<T>()->EachChangedSince(since, std::forward<Func>(func));
+        }
+
+        /**
+         * @brief Gets the current change-tracking tick
+         * @return Tick Current tick
+         */
+        Tick GetTick() const {
+            return m_componentManager.GetTick();
+        }
+
+        /**
+         * @brief Moves the change-tracking clock forward
+         *
+         * A consumer keeps the value returned here and passes it as `since`
+         * on its next EachChanged() call: every modification made after this
+         * call is stamped with that tick or a later one, so none is missed.
+         *
+         * @return Tick The new tick
+         */
+        Tick AdvanceTick() {
+            return m_componentManager.AdvanceTick();
+        }
+
+        // Component Signals
+
+        /**
+         * @brief Gets the signal fired when a component of type T is added to an entity
+         *
+         * Fires after the component is stored, so listeners can read it.
+         *
+         * @tparam T The component type
+         * @return Signal& The signal
+         *
+         * @example
+         * world.OnConstruct<Health>().Connect([&](ECS::EntityID e) { m_alive.push_back(e); }, ECS::Dispatch::Queued);
+         */
+        template<typename T>
+        Signal& OnConstruct() {
+            return m_componentManager.OnConstruct<T>();
+        }
+
+        /**
+         * @brief Gets the signal fired when a component of type T is replaced or modified
+         *
+         * Fires when AddComponent() replaces an existing T and on
+         * ModifyComponent()/MarkChanged(); plain writes through
+         * GetComponent() are not seen.
+         *
+         * @tparam T The component type
+         * @return Signal& The signal
+         */
+        template<typename T>
+        Signal& OnUpdate() {
+            return m_componentManager.OnUpdate<T>();
+        }
+
+        /**
+         * @brief Gets the signal fired right before a component of type T is removed
+         *
+         * Fires on RemoveComponent() and DestroyEntity(), while the
+         * component (and, on destruction, the whole entity) is still readable.
+         *
+         * @tparam T The component type
+         * @return Signal& The signal
+         */
+        template<typename T>
+        Signal& OnDestroy() {
+            return m_componentManager.OnDestroy<T>();
+        }
+
+        /**
+         * @brief Delivers the events recorded for queued listeners
+         *
+         * UpdateSystems() calls this at every sync point, after the
+         * deferred commands are applied; partitions are brought up to date
+         * last. Must not run concurrently with systems.
+         */
+        void DispatchQueuedEvents() {
+            m_componentManager.DispatchQueuedEvents();
+        }
+
         /**
          * @brief Removes a component from an entity
          *
@@ -151,7 +456,129 @@ namespace ECS {
          */
         template<typename T>
         bool HasComponent(EntityID entity) const {
-            return m_componentManager.HasComponent<T>(entity);
+            return m_entityManager.IsEntityAlive(entity) && m_componentManager.HasComponent<T>(entity);
+        }
+
+        /**
+         * @brief Gets the component signature of an entity
+         *
+         * @param entity The EntityID to query
+         * @return Signature The component types owned by the entity (empty if not alive)
+         */
+        Signature GetSignature(EntityID entity) const {
+            return m_entityManager.IsEntityAlive(entity) ? m_componentManager.GetSignature(entity) : Signature();
+        }
+
+        /**
+         * @brief Checks whether an entity owns every component of a signature
+         *
+         * @param entity The EntityID to test
+         * @param required The required component types (see MakeSignature)
+         * @return true if the entity is alive and owns all required components
+         */
+        bool Matches(EntityID entity, const Signature& required) const {
+            return m_entityManager.IsEntityAlive(entity) && m_componentManager.Matches(entity, required);
+        }
+
+        // Tags
+
+        /**
+         * @brief Adds a tag (an empty marker type) to an entity
+         *
+         * Tags are stored as one bit per entity in a per-type bitset, with
+         * no component allocated. They take a signature bit, so HasTag(),
+         * Matches() and OnConstruct/OnDestroy work as for components, but
+         * they are not visible to GetComponent(), views, groups or snapshots.
+         * A type is used either as a tag or as a component, not both.
+         *
+         * @tparam T An empty type
+         * @param entity The EntityID to tag (ignored if not alive)
+         *
+         * @example
+         * struct Boss {};
+         * world.AddTag<Boss>(enemy);
+         * world.EachTagged<Boss>([&](ECS::EntityID boss) { ... });
+         */
+        template<typename T>
+        void AddTag(EntityID entity) {
+            if (m_entityManager.IsEntityAlive(entity)) {
+                m_componentManager.AddTag<T>(entity);
+            }
+        }
+
+        /**
+         * @brief Removes a tag from an entity
+         *
+         * @tparam T An empty type
+         * @param entity The EntityID to untag
+         */
+        template<typename T>
+        void RemoveTag(EntityID entity) {
+            if (m_entityManager.IsEntityAlive(entity)) {
+                m_componentManager.RemoveTag<T>(entity);
+            }
+        }
+
+        /**
+         * @brief Checks whether an entity carries a tag
+         *
+         * @tparam T An empty type
+         * @param entity The EntityID to check
+         * @return true if the entity is alive and tagged
+         */
+        template<typename T>
+        bool HasTag(EntityID entity) const {
+            return HasComponent<T>(entity);
+        }
+
+        /**
+         * @brief Calls a function for every entity carrying a tag
+         *
+         * Scans the tag's bitset one 64-entity word at a time.
+         *
+         * @tparam T An empty type
+         * @tparam Func Callable taking an EntityID
+         * @param func Function to call; may untag or destroy the entity it is given
+         */
+        template<typename T, typename Func>
+        void EachTagged(Func&& func) {
+            m_componentManager.EachTagged<T>(std::forward<Func>(func));
+        }
+
+        /**
+         * @brief Gets the number of entities carrying a tag
+         *
+         * @tparam T An empty type
+         * @return std::size_t Tagged entity count
+         */
+        template<typename T>
+        std::size_t GetTagCount() const {
+            return m_componentManager.GetTagCount<T>();
+        }
+
+        /**
+         * @brief Calls a function for every alive entity matching a signature
+         *
+         * Scans the packed alive list and tests each entity with one bitset
+         * AND, which is how systems declaring a required signature find their
+         * entities without per-component lookups. Iterates a snapshot of the
+         * alive list, so the function may create or destroy entities.
+         *
+         * @tparam Func Callable taking an EntityID
+         * @param required The required component types
+         * @param func Function to call for each match
+         *
+         * @example
+         * world.EachEntity(system.GetSignature(), [&](ECS::EntityID e) { ... });
+         */
+        template<typename Func>
+        void EachEntity(const Signature& required, Func&& func) {
+            const std::vector<EntityID> entities = m_entityManager.GetAllEntities();
+            for (EntityID entity : entities) {
+                if (Matches(entity, required)) {
+                    func(entity);
+                }
+            }
         }
 
         /**
@@ -168,6 +595,196 @@ namespace ECS {
             return m_componentManager.GetAllComponents<T>();
         }
 
+        /**
+         * @brief Creates a view over entities owning all the given component types
+         *
+         * @tparam Ts The required component types
+         * @return ComponentView Iterable view yielding (EntityID, Ts&...)
+         *
+         * @example
+         * world.View<Position, Velocity>().Each([&](ECS::EntityID e, Position& pos, Velocity& vel) {
+         *     pos.x += vel.vx * deltaTime;
+         * });
+         */
+        template<typename... Ts>
+        ComponentView<Exclude<>, Ts...> View() {
+            return ComponentView<Exclude<>, Ts...>(
+                std::make_tuple(m_componentManager.GetAllComponents<Ts>()...), std::make_tuple());
+        }
+
+        /**
+         * @brief Creates a view over entities owning Ts... but none of Ex...
+         *
+         * @tparam Ts The required component types
+         * @tparam Ex The excluded component types (deduced from the tag)
+         * @return ComponentView Iterable view yielding (EntityID, Ts&...)
+         *
+         * @example
+         * for (auto [entity, pos] : world.View<Position>(ECS::Exclude<Player>{})) { ... }
+         */
+        template<typename... Ts, typename... Ex>
+        ComponentView<Exclude<Ex...>, Ts...> View(Exclude<Ex...>) {
+            return ComponentView<Exclude<Ex...>, Ts...>(
+                std::make_tuple(m_componentManager.GetAllComponents<Ts>()...),
+                std::make_tuple(m_componentManager.GetAllComponents<Ex>()...));
+        }
+
+        /**
+         * @brief Gets the persistent owning group for the given component types
+         *
+         * Members are kept packed at the front of every owned pool, so
+         * iterating the group is a linear walk. A component type can only be
+         * owned by one group; the first call builds the group, later calls
+         * return the same instance.
+         *
+         * @tparam Os The owned component types
+         * @return ComponentGroup& The group, valid for the lifetime of the world
+         * @throws std::runtime_error if one of Os is already owned by another group
+         *
+         * @example
+         * world.Group<Position, Velocity>().Each([&](Position& pos, Velocity& vel) { ... });
+         */
+        template<typename... Os>
+        ComponentGroup<With<>, Os...>& Group() {
+            return m_componentManager.GetGroup<Os...>(With<>{});
+        }
+
+        /**
+         * @brief Declares an archetype: entities owning Os... stored together in chunks
+         *
+         * Opts this world into archetype storage for one component set. It
+         * is the owning group of Os...: every entity owning all of them (and
+         * possibly more) is packed in the same slots of each pool, and the
+         * pools are made of fixed-size slabs, so members form chunks with one
+         * contiguous column per type (see ComponentGroup::EachChunk()).
+         * GetComponent(), views and the other accessors work unchanged; worlds
+         * that never declare an archetype keep plain sparse-set storage.
+         *
+         * @tparam Os The component types of the archetype, movable, not owned by another group
+         * @return ComponentGroup& The archetype group, valid for the lifetime of the world
+         * @throws std::runtime_error if one of Os is already owned by another group
+         *
+         * @example
+         * auto& bullets = world.Archetype<Position, Velocity, Projectile>();
+         * bullets.EachChunk([dt](std::size_t n, const ECS::EntityID*, Position* p, Velocity* v, Projectile*) { ... });
+         */
+        template<typename... Os>
+        ComponentGroup<With<>, Os...>& Archetype() {
+            return Group<Os...>();
+        }
+
+        /**
+         * @brief Gets the persistent group owning Os... and observing Ws...
+         *
+         * With an empty Os the group is non-owning: it only keeps its own list
+         * of members and never reorders component storage.
+         *
+         * @tparam Os The owned component types (may be empty)
+         * @tparam Ws The observed component types (deduced from the tag)
+         * @return ComponentGroup& The group, valid for the lifetime of the world
+         *
+         * @example
+         * world.Group<>(ECS::With<Player, Position, Health>{}).Each([&](ECS::EntityID e, Player& p, Position& pos, Health& hp) { ... });
+         */
+        template<typename... Os, typename... Ws>
+        ComponentGroup<With<Ws...>, Os...>& Group(With<Ws...>) {
+            return m_componentManager.GetGroup<Os...>(With<Ws...>{});
+        }
+
+        /**
+         * @brief Gets the secondary index of T keyed by KeyOf, building it on first use
+         *
+         * @tparam T The indexed component type
+         * @tparam KeyOf Default-constructible callable returning the key of a const T&
+         * @return ComponentIndex& The index, valid for the lifetime of the world
+         *
+         * @example
+         * struct ByRoom { ECS::EntityID operator()(const LinkedRoom& link) const { return link.room_id; } };
+         * std::vector<ECS::EntityID> members = world.Index<LinkedRoom, ByRoom>().Find(room);
+         */
+        template<typename T, typename KeyOf>
+        ComponentIndex<T, KeyOf>& Index() {
+            return m_componentManager.GetIndex<T, KeyOf>();
+        }
+
+        /**
+         * @brief Gets the partition of T by a small enum field, building it on first use
+         *
+         * @tparam T The partitioned component type
+         * @tparam KeyOf Default-constructible callable returning the category (enum or integer) of a const T&
+         * @return ComponentPartition& The partition, valid for the lifetime of the world
+         *
+         * @example
+         * world.Partition<Team, Team::ByTeam>().Each(TeamType::Enemy, [&](ECS::EntityID enemy) { ... });
+         */
+        template<typename T, typename KeyOf>
+        ComponentPartition<T, KeyOf>& Partition() {
+            return m_componentManager.GetPartition<T, KeyOf>();
+        }
+
+        // Snapshots
+
+        /**
+         * @brief Serializes every alive entity and its trivially copyable components
+         *
+         * Each component pool is copied with one memcpy per slab.
+         *
+         * @return WorldSnapshot The snapshot
+         */
+        WorldSnapshot Snapshot();
+
+        /**
+         * @brief Serializes the alive entities accepted by a filter
+         *
+         * @tparam Predicate Callable taking an EntityID and returning bool
+         * @param filter Returns true for the entities to save
+         * @return WorldSnapshot The snapshot
+         *
+         * @example
+         * auto room = world.Snapshot([&](ECS::EntityID e) {
+         *     auto* link = world.GetComponent<LinkedRoom>(e);
+         *     return e == roomId || (link && link->room_id == roomId);
+         * });
+         */
+        template<typename Predicate>
+        WorldSnapshot Snapshot(Predicate&& filter) {
+            std::vector<EntityID> selected;
+            for (EntityID entity : m_entityManager.GetAllEntities()) {
+                if (filter(entity)) {
+                    selected.push_back(entity);
+                }
+            }
+            return SnapshotEntities(selected);
+        }
+
+        /**
+         * @brief Serializes the given entities and their trivially copyable components
+         *
+         * @param entities The entities to save; dead handles are skipped
+         * @return WorldSnapshot The snapshot
+         */
+        WorldSnapshot SnapshotEntities(const std::vector<EntityID>& entities);
+
+        /**
+         * @brief Applies a snapshot to the world
+         *
+         * Components go through the same bookkeeping as AddComponent():
+         * groups, indexes and signals stay consistent. In Rollback mode an
+         * entity that is still alive gets its saved components back and
+         * loses the trivially copyable components it gained since; entities
+         * created after the snapshot are left alone. EntityIDs stored inside
+         * components are copied as is: use the returned handles to remap
+         * them after a Clone.
+         *
+         * @param snapshot The snapshot to apply
+         * @param mode How snapshot entities map to world entities
+         * @return std::vector<EntityID> The restored entity of each snapshot entity,
+         *         in WorldSnapshot::GetEntities() order
+         * @throws std::runtime_error if the snapshot is malformed or holds a component
+         *         type unknown to this process; the world is left untouched
+         */
+        std::vector<EntityID> Restore(const WorldSnapshot& snapshot, RestoreMode mode = RestoreMode::Rollback);
+
         // System Management
 
         /**
@@ -257,10 +874,97 @@ namespace ECS {
             return m_systemManager.IsSystemEnabled(systemName);
         }
 
+        // Deferred Commands
+
+        /**
+         * @brief Gets the command buffer of the calling thread
+         *
+         * Record entity creation/destruction and component addition/removal
+         * here while iterating storage. Inside a system run by
+         * UpdateSystems() this is the system's own buffer, applied at the end
+         * of its stage; elsewhere it is the calling thread's buffer, applied
+         * on the next FlushCommands() call.
+         *
+         * @return CommandBuffer& The calling thread's buffer
+         *
+         * @example
+         * world.GetCommandBuffer().DestroyEntity(enemy);
+         */
+        CommandBuffer& GetCommandBuffer() {
+            return m_commands.Local();
+        }
+
+        /**
+         * @brief Applies every deferred command recorded by any thread
+         *
+         * Must not be called while another thread is recording.
+         */
+        void FlushCommands() {
+            m_commands.Playback(*this);
+        }
+
+        /**
+         * @brief Calls a function for every component of type T, from several threads
+         *
+         * Runs on the world's thread pool (see ComponentView::ParallelEach for
+         * the rules the function must follow). Falls back to a plain loop on
+         * the calling thread when there are at most grainSize components.
+         *
+         * @tparam T The component type
+         * @tparam Func Callable taking (EntityID, T&) or (T&)
+         * @param func Function to call, concurrently
+         * @param grainSize Maximum number of components per chunk
+         *
+         * @example
+         * world.ParallelEach<Health>([dt](Health& health) { health.invulnerabilityTimer -= dt; });
+         */
+        template<typename T, typename Func>
+        void ParallelEach(Func&& func, std::size_t grainSize = ThreadPool::DEFAULT_GRAIN_SIZE) {
+            View<T>().ParallelEach(GetThreadPool(), std::forward<Func>(func), grainSize);
+        }
+
+        /**
+         * @brief Calls a function for every entity of a view or group, from several threads
+         *
+         * @tparam Source A ComponentView or ComponentGroup
+         * @tparam Func Callable accepted by Source::Each
+         * @param source The view or group to iterate
+         * @param func Function to call, concurrently
+         * @param grainSize Maximum number of entries per chunk
+         *
+         * @example
+         * world.ParallelEach(world.Group<Position, Velocity>(), [dt](Position& p, Velocity& v) { ... });
+         */
+        template<typename Source, typename Func>
+        void ParallelEach(const Source& source, Func&& func, std::size_t grainSize = ThreadPool::DEFAULT_GRAIN_SIZE) {
+            source.ParallelEach(GetThreadPool(), std::forward<Func>(func), grainSize);
+        }
+
+        /**
+         * @brief Gets the thread pool used to run systems and ParallelEach concurrently
+         *
+         * Created on first use with the configured worker count.
+         *
+         * @return ThreadPool& The world's thread pool
+         */
+        ThreadPool& GetThreadPool();
+
+        /**
+         * @brief Sets the number of worker threads
+         *
+         * 0 runs every system on the calling thread. Must not be called while
+         * systems are updating.
+         *
+         * @param workerCount Number of workers besides the thread calling UpdateSystems()
+         */
+        void SetWorkerCount(std::size_t workerCount);
+
         /**
          * @brief Update all enabled systems
          *
-         * Calls the Update method on all enabled systems in priority order.
+         * Calls the Update method on all enabled systems, in parallel where
+         * their declared component access allows it, flushing deferred
+         * commands after each stage (see SystemManager::UpdateSystems).
          * This should be called once per frame in your game loop.
          *
          * @param deltaTime Time elapsed since last update in seconds
@@ -280,6 +984,23 @@ namespace ECS {
             return m_systemManager.SetSystemPriority(systemName, priority);
         }
 
+        /**
+         * @brief Run a system at a fixed frequency instead of every frame
+         *
+         * @param systemName Name of the system
+         * @param hz Update frequency, 0 to run every frame
+         * @param phase Offset in [0, 1) of the period, or System::AUTO_PHASE to let the scheduler spread systems
+         * @param maxSteps Maximum number of catch-up steps per UpdateSystems() call
+         * @return true if system was found and its rate was set, false otherwise
+         *
+         * @example
+         * world.SetSystemRate("RoomCleanSystem", 2.0f);   // twice per second, whatever the frame rate
+         */
+        bool SetSystemRate(const std::string& systemName, float hz, float phase = System::AUTO_PHASE,
+                           unsigned maxSteps = System::DEFAULT_MAX_STEPS) {
+            return m_systemManager.SetSystemRate(systemName, hz, phase, maxSteps);
+        }
+
         /**
          * @brief Get the number of registered systems
          *
@@ -298,6 +1019,37 @@ namespace ECS {
             return m_systemManager.GetSystemNames();
         }
 
+        /**
+         * @brief Gets the scheduler instrumentation
+         *
+         * Percentiles of the wall time of each system and of whole
+         * UpdateSystems() calls over the last RollingHistogram::WINDOW
+         * frames, and the component count of every component type. Call it
+         * between two UpdateSystems() calls. Empty when built with
+         * ECS_PROFILING=0.
+         *
+         * @return ProfileReport The report
+         *
+         * @example
+         * std::cout << ECS::FormatProfileReport(world.GetProfileReport());
+         */
+        ProfileReport GetProfileReport() const;
+
+        /**
+         * @brief Hands a profile report to a function every few frames
+         *
+         * The function runs at the end of UpdateSystems(), on its thread.
+         *
+         * @param everyFrames Frames between two reports, 0 to stop
+         * @param sink Function receiving the reports
+         *
+         * @example
+         * world.SetProfileDump(600, [](const ECS::ProfileReport& r) { std::cout << ECS::FormatProfileReport(r); });
+         */
+        void SetProfileDump(std::uint64_t everyFrames, std::function<void(const ProfileReport&)> sink) {
+            m_systemManager.SetProfileDump(everyFrames, std::move(sink));
+        }
+
         /**
          * @brief Clears all entities and components from the world
          *
@@ -0,0 +1,139 @@
+/**
+ * @file CommandBuffer.cpp
+ * @brief Implementation of the CommandBuffer and CommandQueue classes
+ * @author R-Type Team
+ * @date 2025
+ */
+
+#include "ECS/CommandBuffer.h"
+#include "ECS/World.h"
+#include <algorithm>
+#include <new>
+
+namespace ECS {
+    unsigned char* CommandBuffer::Reserve(std::size_t size) {
+        if (m_blocks.empty()) {
+            m_blocks.emplace_back();
+        }
+        while (m_blocks[m_current].capacity - m_blocks[m_current].used < size) {
+            if (m_blocks[m_current].used > 0 && ++m_current == m_blocks.size()) {
+                m_blocks.emplace_back();
+            }
+            Block& block = m_blocks[m_current];
+            if (block.capacity < size) {
+                // Empty, so nothing lives in the storage being replaced
+                block.capacity = std::max(BLOCK_SIZE, size);
+                block.bytes = std::make_unique<unsigned char[]>(block.capacity);
+            }
+        }
+        Block& block = m_blocks[m_current];
+        return block.bytes.get() + block.used;
+    }
+
+    void CommandBuffer::Commit(std::size_t size) {
+        m_blocks[m_current].used += size;
+        ++m_count;
+    }
+
+    void CommandBuffer::Reset() {
+        for (std::size_t b = 0; b < m_blocks.size() && b <= m_current; ++b) {
+            Block& block = m_blocks[b];
+            for (std::size_t offset = 0; offset < block.used;) {
+                const Command* command = std::launder(reinterpret_cast<const Command*>(block.bytes.get() + offset));
+                if (command->destroy) {
+                    command->destroy(block.bytes.get() + offset + CALLBACK_OFFSET);
+                }
+                offset += command->size;
+            }
+            block.used = 0;
+        }
+        m_current = 0;
+        m_count = 0;
+    }
+
+    void CommandBuffer::Playback(World& world) {
+        // Index based: callbacks may record more commands into this buffer, appended
+        // after the ones being read; blocks never move their storage
+        for (std::size_t b = 0; b < m_blocks.size() && b <= m_current; ++b) {
+            for (std::size_t offset = 0; offset < m_blocks[b].used;) {
+                unsigned char* bytes = m_blocks[b].bytes.get() + offset;
+                const Command command = *std::launder(reinterpret_cast<const Command*>(bytes));
+                void* callback = bytes + CALLBACK_OFFSET;
+
+                switch (command.type) {
+                    case CommandType::Create: {
+                        EntityID entity = world.CreateEntity();
+                        if (command.invoke) {
+                            command.invoke(callback, world, entity);
+                        }
+                        break;
+                    }
+                    case CommandType::Destroy:
+                        if (world.IsEntityAlive(command.entity)) {
+                            if (command.invoke) {
+                                command.invoke(callback, world, command.entity);
+                            }
+                            world.DestroyEntity(command.entity);
+                        }
+                        break;
+                    case CommandType::Apply:
+                        if (world.IsEntityAlive(command.entity)) {
+                            command.invoke(callback, world, command.entity);
+                        }
+                        break;
+                }
+
+                // Played: destroyed now so Reset() below does not destroy it again
+                if (command.destroy) {
+                    command.destroy(callback);
+                    std::launder(reinterpret_cast<Command*>(bytes))->destroy = nullptr;
+                }
+                offset += command.size;
+            }
+        }
+        Reset();
+    }
+
+    thread_local CommandQueue::Binding CommandQueue::t_binding;
+
+    CommandBuffer& CommandQueue::Local() {
+        if (t_binding.queue == this) {
+            return *t_binding.buffer;
+        }
+
+        const std::thread::id self = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto& [owner, buffer] : m_buffers) {
+            if (owner == self) {
+                return *buffer;
+            }
+        }
+        m_buffers.emplace_back(self, std::make_unique<CommandBuffer>());
+        return *m_buffers.back().second;
+    }
+
+    void CommandQueue::Playback(World& world) {
+        // The lock is not held while playing back, callbacks may fetch their buffer
+        for (std::size_t i = 0;; ++i) {
+            CommandBuffer* buffer = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (i >= m_buffers.size()) {
+                    break;
+                }
+                buffer = m_buffers[i].second.get();
+            }
+            if (!buffer->Empty()) {
+                buffer->Playback(world);
+            }
+        }
+    }
+
+    void CommandQueue::Clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_buffers) {
+            entry.second->Clear();
+        }
+    }
+}
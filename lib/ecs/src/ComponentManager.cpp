@@ -1,24 +1,173 @@
 #include "ECS/ComponentManager.h"
-#include <algorithm>
+#include <cstdlib>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
 
 namespace ECS {
+    bool ComponentManager::NotifyAdded(ComponentTypeID typeID, EntityID entity) {
+        const auto& groups = m_groupsByType[typeID];
+        for (IComponentGroup* group : groups) {
+            group->OnComponentAdded(entity);
+        }
+        return !groups.empty();
+    }
+
+    void ComponentManager::NotifyRemoving(ComponentTypeID typeID, EntityID entity) {
+        for (IComponentGroup* group : m_groupsByType[typeID]) {
+            group->OnComponentRemoving(entity);
+        }
+    }
+
+    IComponentArray* ComponentManager::GetComponentArray(ComponentTypeID typeID) {
+        std::atomic<IComponentArray*>& slot = m_componentArrays[typeID];
+        IComponentArray* array = slot.load(std::memory_order_acquire);
+        if (array) {
+            return array;
+        }
+
+        const ArrayFactory factory = s_arrayFactories[typeID].load(std::memory_order_acquire);
+        if (!factory) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(m_arrayCreationMutex);
+        array = slot.load(std::memory_order_relaxed);
+        if (!array) {
+            m_arrayStorage.push_back(factory());
+            array = m_arrayStorage.back().get();
+            slot.store(array, std::memory_order_release);
+        }
+        return array;
+    }
+
+    ComponentTypeID ComponentManager::FindTypeID(std::uint64_t hash) {
+        std::lock_guard<std::mutex> lock(s_typeIDsByHashMutex);
+        auto it = s_typeIDsByHash.find(hash);
+        return it != s_typeIDsByHash.end() ? it->second : static_cast<ComponentTypeID>(MAX_COMPONENT_TYPES);
+    }
+
+    void ComponentManager::AssignComponent(ComponentTypeID typeID, EntityID entity, const unsigned char* bytes) {
+        IComponentArray* array = GetComponentArray(typeID);
+        Signature& signature = SignatureOf(entity);
+        const bool replacing = signature.test(typeID);
+        signature.set(typeID);
+        array->AssignComponent(entity, bytes);
+        NotifyAdded(typeID, entity);
+
+        Signal& signal = replacing ? m_signals[typeID].update : m_signals[typeID].construct;
+        if (!signal.Empty()) {
+            signal.Emit(entity);
+        }
+    }
+
+    void ComponentManager::RemoveComponent(ComponentTypeID typeID, EntityID entity) {
+        if (!GetSignature(entity).test(typeID)) {
+            return;
+        }
+
+        Signal& signal = m_signals[typeID].destroy;
+        if (!signal.Empty()) {
+            signal.Emit(entity);
+        }
+        NotifyRemoving(typeID, entity);
+        m_componentArrays[typeID].load(std::memory_order_relaxed)->RemoveComponent(entity);
+        m_signatures[GetEntityIndex(entity)].reset(typeID);
+    }
+
     void ComponentManager::RemoveAllComponents(EntityID entity) {
-        auto it = m_entityComponents.find(entity);
-        if (it != m_entityComponents.end()) {
-            for (ComponentTypeID typeID : it->second) {
-                auto arrayIt = m_componentArrays.find(typeID);
-                if (arrayIt != m_componentArrays.end()) {
-                    arrayIt->second->RemoveComponent(entity);
+        const std::uint32_t index = GetEntityIndex(entity);
+        if (index >= m_signatures.size() || m_signatures[index].none()) {
+            return;
+        }
+
+        const Signature signature = m_signatures[index];
+        Signature remaining = signature;
+        for (ComponentTypeID typeID = 0; remaining.any(); ++typeID) {
+            if (remaining.test(typeID)) {
+                remaining.reset(typeID);
+                if (!m_signals[typeID].destroy.Empty()) {
+                    m_signals[typeID].destroy.Emit(entity);
                 }
             }
-            m_entityComponents.erase(it);
         }
+
+        remaining = signature;
+        for (ComponentTypeID typeID = 0; remaining.any(); ++typeID) {
+            if (remaining.test(typeID)) {
+                remaining.reset(typeID);
+                NotifyRemoving(typeID, entity);
+            }
+        }
+
+        remaining = signature & ~m_tagTypes;
+        for (ComponentTypeID typeID = 0; remaining.any(); ++typeID) {
+            if (remaining.test(typeID)) {
+                remaining.reset(typeID);
+                m_componentArrays[typeID].load(std::memory_order_relaxed)->RemoveComponent(entity);
+            }
+        }
+
+        remaining = signature & m_tagTypes;
+        for (ComponentTypeID typeID = 0; remaining.any(); ++typeID) {
+            if (remaining.test(typeID)) {
+                remaining.reset(typeID);
+                m_tags[typeID].Reset(index);
+            }
+        }
+        m_signatures[index].reset();
     }
 
     void ComponentManager::Clear() {
-        for (auto& pair : m_componentArrays) {
-            pair.second->Clear();
+        for (auto& array : m_arrayStorage) {
+            array->Clear();
+        }
+        m_signatures.clear();
+        for (EntityBitset& tagged : m_tags) {
+            tagged.Clear();
+        }
+        for (auto& pair : m_groups) {
+            pair.second->Rebuild();
+        }
+        for (auto& pair : m_indexes) {
+            pair.second->Rebuild();
+        }
+        for (auto& signals : m_signals) {
+            signals.construct.ClearQueued();
+            signals.update.ClearQueued();
+            signals.destroy.ClearQueued();
+        }
+    }
+
+    void ComponentManager::DispatchQueuedEvents() {
+        for (auto& signals : m_signals) {
+            signals.construct.DispatchQueued();
+            signals.update.DispatchQueued();
+            signals.destroy.DispatchQueued();
+        }
+        for (auto& pair : m_indexes) {
+            pair.second->Sync();
+        }
+    }
+
+    std::vector<ComponentCount> ComponentManager::GetComponentCounts() const {
+        std::vector<ComponentCount> counts;
+        for (const auto& slot : m_componentArrays) {
+            const IComponentArray* array = slot.load(std::memory_order_acquire);
+            if (!array) {
+                continue;
+            }
+            std::string name = array->GetTypeName();
+#if defined(__GNUG__)
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+            if (status == 0 && demangled) {
+                name = demangled;
+            }
+            std::free(demangled);
+#endif
+            counts.push_back({std::move(name), array->GetComponentCount()});
         }
-        m_entityComponents.clear();
+        return counts;
     }
 }
@@ -1,62 +1,84 @@
 #include "ECS/EntityManager.h"
 #include <algorithm>
+#include <stdexcept>
 
 namespace ECS {
-    EntityManager::EntityManager() : m_nextEntityID(1) {
+    EntityManager::EntityManager() {
         // Reserve space for better performance
-        m_aliveEntities.reserve(1000);
-    }
-
-    std::vector<std::uint32_t> EntityManager::GetAllEntities() const {
-        std::vector<std::uint32_t> entities;
-        for (EntityID id = 0; id < m_aliveEntities.size(); ++id) {
-            if (m_aliveEntities[id]) {
-                entities.push_back(id);
-            }
-        }
-        return entities;
+        m_slots.reserve(1000);
+        m_alive.reserve(1000);
+        m_slots.push_back({INVALID_ENTITY, NOT_ALIVE});
     }
 
     EntityID EntityManager::CreateEntity() {
-        EntityID entityID;
+        std::uint32_t index;
 
-        if (!m_freeEntities.empty()) {
-            entityID = m_freeEntities.front();
-            m_freeEntities.pop();
+        if (!m_freeIndices.empty()) {
+            index = m_freeIndices.front();
+            m_freeIndices.pop();
         } else {
-            entityID = m_nextEntityID++;
+            if (m_slots.size() > ENTITY_INDEX_MASK) {
+                throw std::runtime_error("ECS: entity index space exhausted");
+            }
+            index = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.push_back({MakeEntity(index, 0), NOT_ALIVE});
         }
 
-        // Ensure the alive entities vector is large enough
-        if (entityID >= m_aliveEntities.size()) {
-            m_aliveEntities.resize(entityID + 1, false);
+        Slot& slot = m_slots[index];
+        slot.alive = static_cast<std::uint32_t>(m_alive.size());
+        m_alive.push_back(slot.handle);
+        return slot.handle;
+    }
+
+    std::vector<EntityID> EntityManager::CreateEntities(std::size_t count) {
+        const std::size_t fresh = count > m_freeIndices.size() ? count - m_freeIndices.size() : 0;
+        if (m_slots.size() + fresh > m_slots.capacity()) {
+            m_slots.reserve(std::max(m_slots.size() + fresh, m_slots.capacity() * 2));
+        }
+        if (m_alive.size() + count > m_alive.capacity()) {
+            m_alive.reserve(std::max(m_alive.size() + count, m_alive.capacity() * 2));
         }
 
-        m_aliveEntities[entityID] = true;
-        return entityID;
+        std::vector<EntityID> entities;
+        entities.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            entities.push_back(CreateEntity());
+        }
+        return entities;
     }
 
     void EntityManager::DestroyEntity(EntityID entity) {
-        if (entity != INVALID_ENTITY && entity < m_aliveEntities.size() && m_aliveEntities[entity]) {
-            m_aliveEntities[entity] = false;
-            m_freeEntities.push(entity);
+        if (!IsEntityAlive(entity)) {
+            return;
         }
-    }
 
-    bool EntityManager::IsEntityAlive(EntityID entity) const {
-        return entity != INVALID_ENTITY &&
-               entity < m_aliveEntities.size() &&
-               m_aliveEntities[entity];
+        const std::uint32_t index = GetEntityIndex(entity);
+        Slot& slot = m_slots[index];
+
+        // Swap-and-pop out of the alive list
+        const EntityID last = m_alive.back();
+        m_alive[slot.alive] = last;
+        m_slots[GetEntityIndex(last)].alive = slot.alive;
+        m_alive.pop_back();
+
+        slot.alive = NOT_ALIVE;
+        slot.handle = MakeEntity(index, GetEntityGeneration(entity) + 1);
+        m_freeIndices.push(index);
     }
 
     void EntityManager::Clear() {
-        m_aliveEntities.clear();
-        std::queue<EntityID> empty;
-        m_freeEntities.swap(empty);
-        m_nextEntityID = 1;
-    }
+        m_alive.clear();
+        std::queue<std::uint32_t> empty;
+        m_freeIndices.swap(empty);
 
-    size_t EntityManager::GetAliveEntityCount() const {
-        return std::count(m_aliveEntities.begin(), m_aliveEntities.end(), true);
+        // Keep generations so that handles issued before Clear() stay invalid
+        for (std::uint32_t index = 1; index < m_slots.size(); ++index) {
+            Slot& slot = m_slots[index];
+            if (slot.alive != NOT_ALIVE) {
+                slot.handle = MakeEntity(index, GetEntityGeneration(slot.handle) + 1);
+                slot.alive = NOT_ALIVE;
+            }
+            m_freeIndices.push(index);
+        }
     }
 }
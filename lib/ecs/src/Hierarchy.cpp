@@ -0,0 +1,73 @@
+/**
+ * @file Hierarchy.cpp
+ * @brief Implementation of the Hierarchy class
+ * @author R-Type Team
+ * @date 2025
+ */
+
+#include "ECS/Hierarchy.h"
+
+namespace ECS {
+    Hierarchy::Node& Hierarchy::NodeOf(EntityID entity) {
+        const std::uint32_t index = GetEntityIndex(entity);
+        if (index >= m_nodes.size()) {
+            m_nodes.resize(index + 1);
+        }
+        return m_nodes[index];
+    }
+
+    void Hierarchy::Attach(EntityID child, EntityID parent, bool destroyWithParent) {
+        Detach(child);
+
+        NodeOf(child);   // grow first: references below must survive both lookups
+        Node& parentNode = NodeOf(parent);
+        Node& childNode = m_nodes[GetEntityIndex(child)];
+        childNode.parent = parent;
+        childNode.destroyWithParent = destroyWithParent;
+        childNode.prevSibling = parentNode.lastChild;
+        childNode.nextSibling = INVALID_ENTITY;
+
+        if (parentNode.lastChild != INVALID_ENTITY) {
+            m_nodes[GetEntityIndex(parentNode.lastChild)].nextSibling = child;
+        } else {
+            parentNode.firstChild = child;
+        }
+        parentNode.lastChild = child;
+        ++parentNode.childCount;
+    }
+
+    void Hierarchy::Detach(EntityID child) {
+        const std::uint32_t index = GetEntityIndex(child);
+        if (index >= m_nodes.size() || m_nodes[index].parent == INVALID_ENTITY) {
+            return;
+        }
+
+        Node& node = m_nodes[index];
+        Node& parent = m_nodes[GetEntityIndex(node.parent)];
+        if (node.prevSibling != INVALID_ENTITY) {
+            m_nodes[GetEntityIndex(node.prevSibling)].nextSibling = node.nextSibling;
+        } else {
+            parent.firstChild = node.nextSibling;
+        }
+        if (node.nextSibling != INVALID_ENTITY) {
+            m_nodes[GetEntityIndex(node.nextSibling)].prevSibling = node.prevSibling;
+        } else {
+            parent.lastChild = node.prevSibling;
+        }
+        --parent.childCount;
+
+        node.parent = INVALID_ENTITY;
+        node.prevSibling = INVALID_ENTITY;
+        node.nextSibling = INVALID_ENTITY;
+        node.destroyWithParent = false;
+    }
+
+    bool Hierarchy::IsAncestor(EntityID ancestor, EntityID entity) const {
+        for (EntityID current = GetParent(entity); current != INVALID_ENTITY; current = GetParent(current)) {
+            if (current == ancestor) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
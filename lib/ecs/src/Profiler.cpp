@@ -0,0 +1,62 @@
+/**
+ * @file Profiler.cpp
+ * @brief Implementation of the timing histograms and report formatting
+ * @author R-Type Team
+ * @date 2025
+ */
+
+#include "ECS/Profiler.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace ECS {
+    TimingStats RollingHistogram::GetStats() const {
+        TimingStats stats;
+        stats.samples = m_count;
+        if (m_count == 0) {
+            return stats;
+        }
+
+        std::array<std::uint32_t, WINDOW> sorted;
+        std::copy(m_samples.begin(), m_samples.begin() + m_count, sorted.begin());
+        std::sort(sorted.begin(), sorted.begin() + m_count);
+
+        // Nearest-rank percentiles, in microseconds
+        auto percentile = [&sorted, this](std::size_t percent) {
+            const std::size_t rank = (percent * m_count + 99) / 100;
+            return sorted[std::max<std::size_t>(rank, 1) - 1] / 1000.0;
+        };
+        stats.p50 = percentile(50);
+        stats.p95 = percentile(95);
+        stats.p99 = percentile(99);
+        stats.max = sorted[m_count - 1] / 1000.0;
+        return stats;
+    }
+
+    std::string FormatProfileReport(const ProfileReport& report) {
+        char line[256];
+        std::string text;
+
+        std::snprintf(line, sizeof(line), "ECS profile, frame %llu (us over the last %zu frames)\n",
+                      static_cast<unsigned long long>(report.frame), report.tick.samples);
+        text += line;
+        std::snprintf(line, sizeof(line), "  %-32s %9s %9s %9s %9s\n", "", "p50", "p95", "p99", "max");
+        text += line;
+
+        auto row = [&line, &text](const std::string& name, const TimingStats& stats) {
+            std::snprintf(line, sizeof(line), "  %-32.32s %9.1f %9.1f %9.1f %9.1f\n",
+                          name.c_str(), stats.p50, stats.p95, stats.p99, stats.max);
+            text += line;
+        };
+        row("(tick)", report.tick);
+        for (const SystemTiming& system : report.systems) {
+            row(system.name, system.stats);
+        }
+
+        for (const ComponentCount& component : report.components) {
+            std::snprintf(line, sizeof(line), "  %-32.32s %9zu components\n", component.typeName.c_str(), component.count);
+            text += line;
+        }
+        return text;
+    }
+}
@@ -0,0 +1,293 @@
+/**
+ * @file Snapshot.cpp
+ * @brief Implementation of WorldSnapshot and of World::Snapshot()/Restore()
+ * @author R-Type Team
+ * @date 2025
+ */
+
+#include "ECS/Snapshot.h"
+#include "ECS/World.h"
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ECS {
+    namespace {
+        /**
+         * @brief Appends raw bytes to a snapshot buffer
+         *
+         * @param out The buffer
+         * @param bytes Number of bytes to append
+         * @return unsigned char* Start of the appended (uninitialized) bytes
+         */
+        unsigned char* Grow(std::vector<unsigned char>& out, std::size_t bytes) {
+            const std::size_t offset = out.size();
+            out.resize(offset + bytes);
+            return out.data() + offset;
+        }
+
+        /**
+         * @brief Appends a range of entity handles to a snapshot buffer
+         *
+         * @param out The buffer
+         * @param entities The handles
+         */
+        void WriteEntities(std::vector<unsigned char>& out, const std::vector<EntityID>& entities) {
+            if (!entities.empty()) {
+                std::memcpy(Grow(out, entities.size() * sizeof(EntityID)), entities.data(), entities.size() * sizeof(EntityID));
+            }
+        }
+
+        /**
+         * @brief Appends a value to a snapshot buffer
+         *
+         * @tparam V A trivially copyable type
+         * @param out The buffer
+         * @param value The value to append
+         */
+        template<typename V>
+        void Write(std::vector<unsigned char>& out, const V& value) {
+            std::memcpy(Grow(out, sizeof(V)), &value, sizeof(V));
+        }
+
+        /**
+         * @brief Bounds-checked sequential reader over a snapshot buffer
+         */
+        class Reader {
+        private:
+            const std::vector<unsigned char>& m_data;
+            std::size_t m_offset = 0;
+
+        public:
+            explicit Reader(const std::vector<unsigned char>& data) : m_data(data) {}
+
+            /**
+             * @brief Consumes bytes
+             *
+             * @param bytes Number of bytes
+             * @return const unsigned char* Start of the consumed bytes
+             * @throws std::runtime_error if the buffer is too short
+             */
+            const unsigned char* Take(std::size_t bytes) {
+                if (bytes > m_data.size() - m_offset) {
+                    throw std::runtime_error("ECS: truncated snapshot");
+                }
+                const unsigned char* start = m_data.data() + m_offset;
+                m_offset += bytes;
+                return start;
+            }
+
+            /**
+             * @brief Consumes a value
+             *
+             * @tparam V A trivially copyable type
+             * @return V The value
+             */
+            template<typename V>
+            V Read() {
+                V value;
+                std::memcpy(&value, Take(sizeof(V)), sizeof(V));
+                return value;
+            }
+
+            /**
+             * @brief Checks whether every byte was consumed
+             * @return true at the end of the buffer
+             */
+            bool AtEnd() const { return m_offset == m_data.size(); }
+        };
+
+        /**
+         * @brief Writes the header and the entity list
+         *
+         * @param out The buffer
+         * @param entities The saved entities
+         */
+        void WriteHeader(std::vector<unsigned char>& out, const std::vector<EntityID>& entities) {
+            Write(out, WorldSnapshot::MAGIC);
+            Write(out, WorldSnapshot::VERSION);
+            Write(out, static_cast<std::uint32_t>(entities.size()));
+            WriteEntities(out, entities);
+        }
+
+        /**
+         * @brief Reads the header and the entity list
+         *
+         * @param reader Reader positioned at the start of the buffer
+         * @return std::vector<EntityID> The saved entities
+         */
+        std::vector<EntityID> ReadHeader(Reader& reader) {
+            if (reader.Read<std::uint32_t>() != WorldSnapshot::MAGIC) {
+                throw std::runtime_error("ECS: not a world snapshot");
+            }
+            if (reader.Read<std::uint32_t>() != WorldSnapshot::VERSION) {
+                throw std::runtime_error("ECS: unsupported snapshot version");
+            }
+            std::vector<EntityID> entities(reader.Read<std::uint32_t>());
+            const unsigned char* handles = reader.Take(entities.size() * sizeof(EntityID));
+            if (!entities.empty()) {
+                std::memcpy(entities.data(), handles, entities.size() * sizeof(EntityID));
+            }
+            return entities;
+        }
+
+        /**
+         * @brief Writes the header of a component block
+         *
+         * @param out The buffer
+         * @param array The component array
+         * @param count Number of components in the block
+         */
+        void WriteBlockHeader(std::vector<unsigned char>& out, const IComponentArray& array, std::size_t count) {
+            Write(out, array.GetTypeHash());
+            Write(out, static_cast<std::uint32_t>(array.GetSnapshotSize()));
+            Write(out, static_cast<std::uint32_t>(count));
+        }
+
+        /**
+         * @brief A component block validated against this process's types
+         */
+        struct Block {
+            ComponentTypeID typeID;
+            std::size_t size;
+            std::size_t count;
+            const unsigned char* entities;
+            const unsigned char* bytes;
+        };
+    }
+
+    std::vector<EntityID> WorldSnapshot::GetEntities() const {
+        Reader reader(m_data);
+        return ReadHeader(reader);
+    }
+
+    WorldSnapshot World::Snapshot() {
+        WorldSnapshot snapshot;
+        std::vector<unsigned char>& out = snapshot.m_data;
+        WriteHeader(out, m_entityManager.GetAllEntities());
+
+        // Whole pools: entity list and component slabs are copied as is
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+            const IComponentArray* array = m_componentManager.FindComponentArray(typeID);
+            if (!array || array->GetSnapshotSize() == 0 || array->GetComponentCount() == 0) {
+                continue;
+            }
+            const std::size_t count = array->GetComponentCount();
+            WriteBlockHeader(out, *array, count);
+            const std::size_t entityBytes = count * sizeof(EntityID);
+            unsigned char* block = Grow(out, entityBytes + count * array->GetSnapshotSize());
+            std::vector<EntityID> entities(count);
+            array->CopyAll(entities.data(), block + entityBytes);
+            std::memcpy(block, entities.data(), entityBytes);
+        }
+        return snapshot;
+    }
+
+    WorldSnapshot World::SnapshotEntities(const std::vector<EntityID>& entities) {
+        std::vector<EntityID> selected;
+        std::unordered_set<EntityID> seen;
+        Signature used;
+        for (EntityID entity : entities) {
+            if (IsEntityAlive(entity) && seen.insert(entity).second) {
+                selected.push_back(entity);
+                used |= m_componentManager.GetSignature(entity);
+            }
+        }
+
+        WorldSnapshot snapshot;
+        std::vector<unsigned char>& out = snapshot.m_data;
+        WriteHeader(out, selected);
+
+        std::vector<EntityID> owners;
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+            const IComponentArray* array = used.test(typeID) ? m_componentManager.FindComponentArray(typeID) : nullptr;
+            if (!array || array->GetSnapshotSize() == 0) {
+                continue;
+            }
+            owners.clear();
+            for (EntityID entity : selected) {
+                if (m_componentManager.GetSignature(entity).test(typeID)) {
+                    owners.push_back(entity);
+                }
+            }
+
+            const std::size_t size = array->GetSnapshotSize();
+            WriteBlockHeader(out, *array, owners.size());
+            WriteEntities(out, owners);
+            unsigned char* bytes = Grow(out, owners.size() * size);
+            for (std::size_t i = 0; i < owners.size(); ++i) {
+                array->CopyComponent(owners[i], bytes + i * size);
+            }
+        }
+        return snapshot;
+    }
+
+    std::vector<EntityID> World::Restore(const WorldSnapshot& snapshot, RestoreMode mode) {
+        // Validate everything before touching the world
+        Reader reader(snapshot.m_data);
+        const std::vector<EntityID> saved = ReadHeader(reader);
+        std::vector<Block> blocks;
+        while (!reader.AtEnd()) {
+            Block block{};
+            // Type IDs depend on registration order: the hash finds this process's one
+            block.typeID = ComponentManager::FindTypeID(reader.Read<std::uint64_t>());
+            block.size = reader.Read<std::uint32_t>();
+            block.count = reader.Read<std::uint32_t>();
+
+            const IComponentArray* array = block.typeID < MAX_COMPONENT_TYPES
+                ? m_componentManager.GetComponentArray(block.typeID) : nullptr;
+            if (!array || array->GetSnapshotSize() != block.size || block.size == 0) {
+                throw std::runtime_error("ECS: snapshot component type unknown to this process");
+            }
+            block.entities = reader.Take(block.count * sizeof(EntityID));
+            block.bytes = reader.Take(block.count * block.size);
+            blocks.push_back(block);
+        }
+
+        std::vector<EntityID> restored(saved.size());
+        std::unordered_map<EntityID, std::size_t> ordinals;
+        ordinals.reserve(saved.size());
+        for (std::size_t i = 0; i < saved.size(); ++i) {
+            ordinals.emplace(saved[i], i);
+            const bool rewind = mode == RestoreMode::Rollback && IsEntityAlive(saved[i]);
+            restored[i] = rewind ? saved[i] : CreateEntity();
+        }
+
+        std::vector<Signature> restoredTypes(saved.size());
+        for (const Block& block : blocks) {
+            for (std::size_t k = 0; k < block.count; ++k) {
+                EntityID entity;
+                std::memcpy(&entity, block.entities + k * sizeof(EntityID), sizeof(EntityID));
+                auto it = ordinals.find(entity);
+                if (it == ordinals.end()) {
+                    continue;
+                }
+                m_componentManager.AssignComponent(block.typeID, restored[it->second], block.bytes + k * block.size);
+                restoredTypes[it->second].set(block.typeID);
+            }
+        }
+
+        if (mode == RestoreMode::Rollback) {
+            // Rewound entities lose the snapshotted types they gained since
+            Signature snapshotted;
+            for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENT_TYPES; ++typeID) {
+                const IComponentArray* array = m_componentManager.FindComponentArray(typeID);
+                snapshotted.set(typeID, array && array->GetSnapshotSize() > 0);
+            }
+            for (std::size_t i = 0; i < saved.size(); ++i) {
+                if (restored[i] != saved[i]) {
+                    continue;
+                }
+                Signature extra = m_componentManager.GetSignature(restored[i]) & snapshotted & ~restoredTypes[i];
+                for (ComponentTypeID typeID = 0; extra.any(); ++typeID) {
+                    if (extra.test(typeID)) {
+                        extra.reset(typeID);
+                        m_componentManager.RemoveComponent(typeID, restored[i]);
+                    }
+                }
+            }
+        }
+        return restored;
+    }
+}
@@ -7,13 +7,16 @@
 
 #include "ECS/SystemManager.h"
 #include "ECS/World.h"
+#include <chrono>
+#include <cmath>
 #include <stdexcept>
 
 namespace ECS {
     void SystemManager::SortSystems() {
         if (!m_needsSort) return;
 
-        std::sort(m_systems.begin(), m_systems.end(),
+        // Stable: systems sharing a priority keep their registration order
+        std::stable_sort(m_systems.begin(), m_systems.end(),
             [](const std::unique_ptr<System>& a, const std::unique_ptr<System>& b) {
                 return a->GetPriority() < b->GetPriority();
             });
@@ -82,14 +85,120 @@ namespace ECS {
         return (it != m_systemMap.end()) ? it->second->IsEnabled() : false;
     }
 
+    void SystemManager::BuildStages() {
+        m_levels.clear();
+        m_stageCount = 0;
+
+        for (auto& system : m_systems) {
+            if (!system->IsEnabled() || system->m_pendingSteps == 0) {
+                continue;
+            }
+
+            size_t level = 0;
+            for (const auto& [earlier, earlierLevel] : m_levels) {
+                if (earlierLevel >= level && system->ConflictsWith(*earlier)) {
+                    level = earlierLevel + 1;
+                }
+            }
+            m_levels.emplace_back(system.get(), level);
+            m_stageCount = std::max(m_stageCount, level + 1);
+        }
+
+        if (m_stages.size() < m_stageCount) {
+            m_stages.resize(m_stageCount);
+        }
+        for (size_t i = 0; i < m_stageCount; ++i) {
+            m_stages[i].clear();
+        }
+        for (const auto& [system, level] : m_levels) {
+            m_stages[level].push_back(system);
+        }
+    }
+
+    unsigned SystemManager::ScheduleSteps(System& system, float deltaTime) {
+        if (system.m_updateRate <= 0.0f) {
+            return 1;
+        }
+
+        const float period = 1.0f / system.m_updateRate;
+        if (!system.m_scheduled) {
+            if (system.m_phase < 0.0f) {
+                // Golden-ratio sequence: every new phase lands in the largest gap left by the previous ones
+                system.m_phase = m_nextAutoPhase;
+                m_nextAutoPhase = std::fmod(m_nextAutoPhase + 0.618034f, 1.0f);
+            }
+            // Phase 0 runs on the first frame, phase p one p * period later
+            system.m_accumulator = (1.0f - std::fmod(system.m_phase, 1.0f)) * period;
+            system.m_scheduled = true;
+        }
+
+        system.m_accumulator += deltaTime;
+        unsigned steps = 0;
+        while (system.m_accumulator >= period && steps < system.m_maxSteps) {
+            system.m_accumulator -= period;
+            ++steps;
+        }
+        if (system.m_accumulator >= period) {
+            // Catch-up limit reached: drop the backlog, keep the phase
+            system.m_accumulator = std::fmod(system.m_accumulator, period);
+        }
+        return steps;
+    }
+
+    void SystemManager::RunSystem(World& world, System& system, float deltaTime) {
+        CommandQueue::ScopedBinding binding(world.m_commands, system.m_commandBuffer);
+        const float stepTime = system.m_updateRate > 0.0f ? 1.0f / system.m_updateRate : deltaTime;
+#if ECS_PROFILING
+        const auto start = std::chrono::steady_clock::now();
+#endif
+        for (unsigned step = 0; step < system.m_pendingSteps; ++step) {
+            system.Update(world, stepTime);
+        }
+#if ECS_PROFILING
+        system.m_timings.Record(std::chrono::steady_clock::now() - start);
+#endif
+    }
+
     void SystemManager::UpdateSystems(World& world, float deltaTime) {
+#if ECS_PROFILING
+        const auto start = std::chrono::steady_clock::now();
+#endif
         SortSystems();
-
         for (auto& system : m_systems) {
-            if (system->IsEnabled()) {
-                system->Update(world, deltaTime);
+            system->m_pendingSteps = system->IsEnabled() ? ScheduleSteps(*system, deltaTime) : 0;
+        }
+        BuildStages();
+
+        for (size_t i = 0; i < m_stageCount; ++i) {
+            const std::vector<System*>& stage = m_stages[i];
+
+            if (stage.size() == 1) {
+                RunSystem(world, *stage.front(), deltaTime);
+            } else {
+                m_tasks.clear();
+                for (System* system : stage) {
+                    m_tasks.emplace_back([this, &world, system, deltaTime]() {
+                        RunSystem(world, *system, deltaTime);
+                    });
+                }
+                world.GetThreadPool().Run(m_tasks);
             }
+
+            // Sync point: apply the structural changes the stage deferred, then deliver queued events
+            for (System* system : stage) {
+                system->m_commandBuffer.Playback(world);
+            }
+            world.FlushCommands();
+            world.DispatchQueuedEvents();
+        }
+
+#if ECS_PROFILING
+        m_tickTimes.Record(std::chrono::steady_clock::now() - start);
+        ++m_frame;
+        if (m_dumpInterval != 0 && m_frame % m_dumpInterval == 0 && m_dumpSink) {
+            m_dumpSink(world.GetProfileReport());
         }
+#endif
     }
 
     bool SystemManager::SetSystemPriority(const std::string& systemName, int priority) {
@@ -102,6 +211,15 @@ namespace ECS {
         return false;
     }
 
+    bool SystemManager::SetSystemRate(const std::string& systemName, float hz, float phase, unsigned maxSteps) {
+        System* system = GetSystem(systemName);
+        if (system) {
+            system->SetUpdateRate(hz, phase, maxSteps);
+            return true;
+        }
+        return false;
+    }
+
     std::vector<std::string> SystemManager::GetSystemNames() const {
         std::vector<std::string> names;
         names.reserve(m_systems.size());
@@ -123,4 +241,23 @@ namespace ECS {
         m_systemMap.clear();
         m_needsSort = false;
     }
+
+    void SystemManager::GetTimings([[maybe_unused]] ProfileReport& report) const {
+#if ECS_PROFILING
+        report.frame = m_frame;
+        report.tick = m_tickTimes.GetStats();
+        report.systems.clear();
+        for (const auto& system : m_systems) {
+            report.systems.push_back({system->GetName(), system->m_timings.GetStats()});
+        }
+#endif
+    }
+
+    void SystemManager::SetProfileDump([[maybe_unused]] std::uint64_t everyFrames,
+                                       [[maybe_unused]] std::function<void(const ProfileReport&)> sink) {
+#if ECS_PROFILING
+        m_dumpInterval = everyFrames;
+        m_dumpSink = std::move(sink);
+#endif
+    }
 }
@@ -0,0 +1,176 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the ThreadPool class
+ * @author R-Type Team
+ * @date 2025
+ */
+
+#include "ECS/ThreadPool.h"
+
+namespace ECS {
+    namespace {
+        /**
+         * @brief Pool the calling thread works for, if any
+         */
+        thread_local const ThreadPool* t_pool = nullptr;
+
+        /**
+         * @brief Deque index of the calling worker thread
+         */
+        thread_local std::size_t t_queueIndex = 0;
+    }
+
+    ThreadPool::ThreadPool(std::size_t workerCount) {
+        m_queues.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i) {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        m_workers.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i) {
+            m_workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadPool::DefaultWorkerCount() {
+        const unsigned int cores = std::thread::hardware_concurrency();
+        return cores > 1 ? cores - 1 : 0;
+    }
+
+    std::size_t ThreadPool::HomeQueue() {
+        if (t_pool == this) {
+            return t_queueIndex;
+        }
+        return m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    }
+
+    bool ThreadPool::FindTask(std::size_t home, Task& task) {
+        if (m_pending.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        for (std::size_t offset = 0; offset < m_queues.size(); ++offset) {
+            WorkerQueue& queue = *m_queues[(home + offset) % m_queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            // Owner takes the newest task, thieves the oldest one
+            if (offset == 0) {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            } else {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+            }
+            m_pending.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::Execute(const Task& task) {
+        try {
+            (*task.function)();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!task.batch->error) {
+                task.batch->error = std::current_exception();
+            }
+        }
+
+        if (task.batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // Last task of the batch: wake its submitter (lock so the wakeup cannot be missed)
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake.notify_all();
+        }
+    }
+
+    void ThreadPool::WorkerLoop(std::size_t index) {
+        t_pool = this;
+        t_queueIndex = index;
+
+        while (true) {
+            Task task;
+            if (FindTask(index, task)) {
+                Execute(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() {
+                return m_stopping || m_pending.load(std::memory_order_acquire) > 0;
+            });
+            if (m_stopping && m_pending.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    void ThreadPool::Run(const std::vector<std::function<void()>>& tasks) {
+        if (tasks.empty()) {
+            return;
+        }
+        if (m_workers.empty() || tasks.size() == 1) {
+            for (const auto& task : tasks) {
+                task();
+            }
+            return;
+        }
+
+        Batch batch;
+        batch.remaining.store(tasks.size(), std::memory_order_relaxed);
+
+        // Count first (under the lock, so sleepers cannot miss it), then publish
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.fetch_add(tasks.size(), std::memory_order_acq_rel);
+        }
+
+        const std::size_t home = HomeQueue();
+        if (t_pool == this) {
+            // Nested batch: keep it on this worker's deque, idle workers steal from it
+            WorkerQueue& queue = *m_queues[home];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (const auto& task : tasks) {
+                queue.tasks.push_back({&task, &batch});
+            }
+        } else {
+            for (std::size_t i = 0; i < tasks.size(); ++i) {
+                WorkerQueue& queue = *m_queues[(home + i) % m_queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back({&tasks[i], &batch});
+            }
+        }
+        m_wake.notify_all();
+
+        // Help until the batch is done; run any queued task, it keeps the pool moving
+        while (batch.remaining.load(std::memory_order_acquire) > 0) {
+            Task task;
+            if (FindTask(home, task)) {
+                Execute(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this, &batch]() {
+                return batch.remaining.load(std::memory_order_acquire) == 0
+                    || m_pending.load(std::memory_order_acquire) > 0;
+            });
+        }
+
+        if (batch.error) {
+            std::rethrow_exception(batch.error);
+        }
+    }
+}
@@ -6,10 +6,33 @@ namespace ECS {
     }
 
     void World::DestroyEntity(EntityID entity) {
-        if (IsEntityAlive(entity)) {
-            m_componentManager.RemoveAllComponents(entity);
-            m_entityManager.DestroyEntity(entity);
+        if (!IsEntityAlive(entity)) {
+            return;
         }
+
+        if (m_hierarchy.GetChildCount(entity) > 0) {
+            // Children go first, while their parent is still alive and readable
+            for (EntityID child : GetChildren(entity)) {
+                if (m_hierarchy.DestroysWithParent(child)) {
+                    DestroyEntity(child);
+                } else {
+                    m_hierarchy.Detach(child);
+                }
+            }
+        }
+        m_hierarchy.Detach(entity);
+
+        m_componentManager.RemoveAllComponents(entity);
+        m_entityManager.DestroyEntity(entity);
+    }
+
+    bool World::SetParent(EntityID child, EntityID parent, bool destroyWithParent) {
+        if (child == parent || !IsEntityAlive(child) || !IsEntityAlive(parent)
+            || m_hierarchy.IsAncestor(child, parent)) {
+            return false;
+        }
+        m_hierarchy.Attach(child, parent, destroyWithParent);
+        return true;
     }
 
     bool World::IsEntityAlive(EntityID entity) const {
@@ -18,11 +41,36 @@ namespace ECS {
 
     void World::Clear() {
         m_systemManager.Clear(*this);
+        m_commands.Clear();
         m_componentManager.Clear();
+        m_hierarchy.Clear();
         m_entityManager.Clear();
     }
 
     size_t World::GetAliveEntityCount() const {
         return m_entityManager.GetAliveEntityCount();
     }
+
+    ProfileReport World::GetProfileReport() const {
+        ProfileReport report;
+#if ECS_PROFILING
+        m_systemManager.GetTimings(report);
+        report.components = m_componentManager.GetComponentCounts();
+#endif
+        return report;
+    }
+
+    ThreadPool& World::GetThreadPool() {
+        std::lock_guard<std::mutex> lock(m_threadPoolMutex);
+        if (!m_threadPool) {
+            m_threadPool = std::make_unique<ThreadPool>(m_workerCount);
+        }
+        return *m_threadPool;
+    }
+
+    void World::SetWorkerCount(std::size_t workerCount) {
+        std::lock_guard<std::mutex> lock(m_threadPoolMutex);
+        m_workerCount = workerCount;
+        m_threadPool.reset();
+    }
 }
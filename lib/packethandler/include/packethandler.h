@@ -17,7 +17,7 @@
  * @brief Callback function type for packet handling
  *
  * This function type receives the full packet_t structure and is responsible
- * for casting packet.data to the appropriate type based on packet.header.type
+ * for casting packet.data() to the appropriate type based on packet.header.type
  */
 using PacketCallback = std::function<void(const packet_t &)>;
 
@@ -12,6 +12,7 @@
 #ifndef PACKET_H
 #define PACKET_H
 #include <cstdint>
+#include "packetbuffer.h"
 
 /**
  * @brief Network packet header structure
@@ -33,11 +34,19 @@ typedef struct packet_header_s {
     /**
      * @brief Acknowledgment number for received packets
      *
-     * Confirms receipt of packets up to this sequence number.
-     * Used by the receiver to acknowledge successful packet delivery.
+     * Latest sequence ID the sender of this packet has received, 0 if none.
+     * Every packet carries it, so acknowledgements ride on regular traffic.
      */
     uint32_t ack;
 
+    /**
+     * @brief Receipt of the PACKET_ACK_BITS sequence IDs before ack
+     *
+     * Bit i is set when sequence ID ack - 1 - i has been received. A clear
+     * bit tells the peer that packet is missing and must be resent.
+     */
+    uint64_t ack_bits;
+
     /**
      * @brief Packet type identifier (0-255)
      *
@@ -89,12 +98,16 @@ typedef struct packet_header_s {
     uint32_t original_size;
 } packet_header_t;
 
+static_assert(sizeof(packet_header_t) == PACKET_BUFFER_HEADROOM,
+              "PACKET_BUFFER_HEADROOM must match the size of packet_header_t");
+
 /**
  * @brief Complete network packet structure
  *
  * Represents a complete network packet consisting of a header with
  * metadata and a data payload. This is the primary structure used
  * throughout the networking system for all packet operations.
+ * Copying a packet shares its payload bytes instead of duplicating them.
  */
 typedef struct packet_s {
     /**
@@ -106,13 +119,25 @@ typedef struct packet_s {
     packet_header_t header;
 
     /**
-     * @brief Packet data payload
+     * @brief Pooled storage of the packet in its wire layout
+     *
+     * Header room followed by the header.data_size payload bytes. May be
+     * empty for packets without payload.
+     */
+    PacketBuffer buffer;
+
+    /**
+     * @brief Gets the packet data payload
+     *
+     * The size is specified in header.data_size. The bytes belong to the
+     * buffer and stay valid as long as a copy of this packet (or of its
+     * buffer) is alive.
      *
-     * Pointer to the actual packet data. The size is specified in
-     * header.data_size. Memory management of this data is handled
-     * by the packet management systems.
+     * @return const void* The payload, or nullptr if the packet has none
      */
-    void *data;
+    [[nodiscard]] const void *data() const {
+        return header.data_size > 0 ? buffer.payload() : nullptr;
+    }
 } packet_t;
 
 #endif //PACKET_H
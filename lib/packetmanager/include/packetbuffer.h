@@ -0,0 +1,143 @@
+/**
+ * @file packetbuffer.h
+ * @brief Pooled, reference-counted storage for packet bytes
+ * @author R-Type Team
+ * @date 2025
+ *
+ * This file defines PacketBuffer, the storage behind every packet_t. A
+ * buffer holds a packet in its wire layout: room for the header followed by
+ * the payload. The payload is written once, when the packet is built or
+ * received; the send queue, the retransmission history and the socket layer
+ * then share the same bytes by copying the handle, never the data.
+ */
+
+#ifndef PACKETBUFFER_H
+#define PACKETBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Number of bytes reserved in front of the payload for the header
+ *
+ * Matches sizeof(packet_header_t), checked in packet.h.
+ */
+#define PACKET_BUFFER_HEADROOM 40
+
+/**
+ * @brief Shared handle to a pooled block of packet bytes
+ *
+ * Copying a PacketBuffer shares the block and bumps an atomic reference
+ * count; the last handle released gives the block back to a process-wide
+ * pool, sorted by power-of-two capacity, so steady traffic stops allocating
+ * once the pool is warm. Blocks larger than the biggest size class are
+ * allocated and freed directly. Handles can be released on any thread.
+ */
+class PacketBuffer {
+public:
+    /**
+     * @brief Creates an empty handle, with no storage
+     */
+    PacketBuffer() = default;
+
+    /**
+     * @brief Takes a block from the pool
+     *
+     * The header room and the payload are left uninitialized.
+     *
+     * @param payload_size Number of payload bytes the buffer holds
+     * @return PacketBuffer Handle to a block of at least that capacity
+     */
+    static PacketBuffer allocate(size_t payload_size);
+
+    PacketBuffer(const PacketBuffer &other) noexcept;
+    PacketBuffer(PacketBuffer &&other) noexcept;
+    PacketBuffer &operator=(const PacketBuffer &other) noexcept;
+    PacketBuffer &operator=(PacketBuffer &&other) noexcept;
+
+    /**
+     * @brief Releases this handle, returning the block to the pool if it was the last
+     */
+    ~PacketBuffer();
+
+    /**
+     * @brief Gets the wire bytes: the header room followed by the payload
+     * @return uint8_t* First byte of the header room, or nullptr if empty
+     */
+    [[nodiscard]] uint8_t *bytes() const;
+
+    /**
+     * @brief Gets the number of wire bytes, header room included
+     * @return size_t PACKET_BUFFER_HEADROOM + payloadSize(), or 0 if empty
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Gets the payload, right after the header room
+     * @return uint8_t* First payload byte, or nullptr if empty
+     */
+    [[nodiscard]] uint8_t *payload() const;
+
+    /**
+     * @brief Gets the number of payload bytes
+     * @return size_t The payload size
+     */
+    [[nodiscard]] size_t payloadSize() const;
+
+    /**
+     * @brief Gets the largest payload the block can hold
+     * @return size_t The payload capacity
+     */
+    [[nodiscard]] size_t capacity() const;
+
+    /**
+     * @brief Changes the payload size, without moving or clearing any byte
+     *
+     * @param payload_size New payload size, at most capacity()
+     */
+    void resize(size_t payload_size);
+
+    /**
+     * @brief Gets the number of handles sharing the block
+     * @return long The reference count, or 0 if empty
+     */
+    [[nodiscard]] long useCount() const;
+
+    /**
+     * @brief Checks whether the handle has storage
+     */
+    explicit operator bool() const { return _block != nullptr; }
+
+    /**
+     * @brief Gets the number of free blocks held by the pool, all size classes together
+     * @return size_t The number of pooled blocks
+     */
+    static size_t pooledBlocks();
+
+private:
+    /**
+     * @brief Bookkeeping in front of every block, followed by the bytes
+     */
+    struct block_t {
+        std::atomic<uint32_t> refs;
+        uint32_t size_class;
+        size_t capacity;
+        size_t size;
+    };
+
+    /**
+     * @brief Offset of the header room in a block, chosen so the payload after it is max_align_t aligned
+     */
+    static constexpr size_t _STORAGE_OFFSET =
+        ((sizeof(block_t) + PACKET_BUFFER_HEADROOM + alignof(std::max_align_t) - 1) &
+         ~(alignof(std::max_align_t) - 1)) - PACKET_BUFFER_HEADROOM;
+
+    explicit PacketBuffer(block_t *block) : _block(block) {}
+
+    void _release();
+
+    block_t *_block = nullptr;
+};
+
+#endif //PACKETBUFFER_H
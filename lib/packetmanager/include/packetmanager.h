@@ -16,7 +16,9 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <chrono>
 #include "packet.h"
+#include "packetbuffer.h"
 #include <zlib.h>
 
 /**
@@ -27,6 +29,76 @@
  */
 #define PACKET_HISTORY_SIZE 512
 
+/**
+ * @brief Default maximum number of buffer bytes held by the transmission history
+ *
+ * Every PlayerConn owns a PacketManager, so this bounds the retransmission
+ * memory per connected player. The oldest packets are dropped first.
+ */
+#define PACKET_HISTORY_BYTES (256 * 1024)
+
+/**
+ * @brief Number of sequence IDs before the latest one acknowledged by packet_header_t::ack_bits
+ */
+#define PACKET_ACK_BITS 64
+
+/**
+ * @brief Longest time a receipt waits for an outgoing packet to ride on, in milliseconds
+ *
+ * Past it, a header-only acknowledgement is sent. Losses are reported at once.
+ */
+#define PACKET_ACK_DELAY_MS 33
+
+/**
+ * @brief Number of newer packets the peer must acknowledge before a packet still missing is resent again
+ */
+#define PACKET_RESEND_DISTANCE 16
+
+/**
+ * @brief Round-trip time assumed before the first one is measured, in milliseconds
+ */
+#define PACKET_INITIAL_RTT_MS 100
+
+/**
+ * @brief Shortest time a packet waits for its acknowledgement before being resent, in milliseconds
+ *
+ * Above PACKET_ACK_DELAY_MS, so a delayed receipt is not taken for a loss.
+ * The timeout is otherwise twice the measured round-trip time.
+ */
+#define PACKET_RESEND_MIN_MS 50
+
+/**
+ * @brief Number of sequence IDs the receiver holds back to deliver important packets in order
+ *
+ * The same as the acknowledgement window. Packets further than that past
+ * the oldest hole are refused unacknowledged, so the peer keeps and resends
+ * them; the latest receipt therefore never gets more than a window ahead of
+ * the oldest hole.
+ */
+#define PACKET_REORDER_WINDOW PACKET_ACK_BITS
+
+/**
+ * @brief Default largest datagram built by fetchDatagramsToSend(), header included
+ *
+ * Small enough to avoid IP fragmentation on common links.
+ */
+#define PACKET_DEFAULT_MTU 1200
+
+/**
+ * @brief Packet type of a datagram carrying several messages
+ *
+ * Never delivered as such: the receiver splits it into the messages.
+ */
+#define PACKET_TYPE_BUNDLE 255
+
+/**
+ * @brief Size of the sub-header in front of each message of a bundle
+ *
+ * seqid (4 bytes), type (1 byte) and data size (2 bytes), in host byte
+ * order like packet_header_t, without padding.
+ */
+#define PACKET_MESSAGE_HEADER_SIZE 7
+
 struct sockaddr_in;
 
 /**
@@ -35,7 +107,13 @@ struct sockaddr_in;
  * PacketManager provides reliable packet transmission over UDP by implementing:
  * - Automatic sequence numbering for packet ordering
  * - Retransmission of lost packets
- * - Acknowledgment tracking and handling
+ * - Selective acknowledgements: every outgoing header carries the latest
+ *   received sequence ID and a bitfield of the PACKET_ACK_BITS before it,
+ *   so receipts and losses are reported without extra datagrams
+ * - In-order delivery of important packets, without duplicates, through a
+ *   PACKET_REORDER_WINDOW sliding window
+ * - Coalescing of small messages into datagrams of at most one MTU, each
+ *   message keeping its own type and sequence ID
  * - Packet buffering for send and receive operations
  * - Serialization and deserialization of packet data
  * - Thread-safe operations with mutex protection
@@ -86,6 +164,7 @@ public:
      *
      * Converts raw network bytes into a structured packet_t object.
      * This is the unsafe version that requires pre-allocated packet storage.
+     * The payload is copied (or decompressed) once into a pooled buffer.
      * Thread-safe: This is a static method working on local data.
      *
      * @param data Pointer to raw packet bytes including header
@@ -112,7 +191,8 @@ public:
      * @brief Serializes a packet structure into raw bytes for transmission
      *
      * Converts a structured packet_t object into raw bytes suitable
-     * for network transmission.
+     * for network transmission. This copies the packet; socket layers
+     * should use wireBytes(), which does not.
      * Thread-safe: This is a static method working on local data.
      *
      * @param packet The packet structure to serialize
@@ -120,6 +200,20 @@ public:
      */
     static std::vector<uint8_t> serializePacket(const packet_t &packet);
 
+    /**
+     * @brief Gets the bytes to put on the wire for a packet, without copying the payload
+     *
+     * Writes packet.header into the header room of the packet buffer, in
+     * front of the payload, and returns the whole buffer. Packets without
+     * payload get a header-only buffer from the pool.
+     * Thread-safe as long as no other thread sends a packet sharing the same buffer.
+     *
+     * @param packet The packet to send; its buffer holds header.data_size payload bytes
+     * @param size Set to the number of bytes to send
+     * @return const uint8_t* The serialized packet, valid while the packet is alive
+     */
+    static const uint8_t *wireBytes(packet_t &packet, size_t *size);
+
     /**
      * @brief Cleans up internal buffers and resets state (Thread-Safe)
      *
@@ -141,27 +235,63 @@ public:
      */
     void handlePacketBytes(const uint8_t *data, size_t size, sockaddr_in client_addr);
 
+    /**
+     * @brief Handles a datagram received directly into a pooled buffer (Thread-Safe)
+     *
+     * Same as handlePacketBytes(), but an uncompressed payload is kept in
+     * place: the buffer becomes the storage of the received packet.
+     *
+     * @param buffer The whole datagram, header included; its size is the datagram size
+     * @param client_addr Socket address of the packet sender
+     */
+    void handlePacketBuffer(PacketBuffer buffer, sockaddr_in client_addr);
+
     /**
      * @brief Safe packet transmission with automatic memory management (Thread-Safe)
      *
      * Creates a packet from the provided data, assigns sequence numbers
-     * for important packets, and prepares it for transmission. Returns
-     * a smart pointer to avoid memory leaks.
+     * for important packets, and prepares it for transmission. The payload
+     * is written (compressed if worth it) once into a pooled buffer, which
+     * the send queue, the history and the returned handle all share.
      *
      * @param data Pointer to payload data to be sent
      * @param data_size Size of the payload data
      * @param packet_type Type identifier for the packet (0-255)
      * @param output_size Pointer to store the size of serialized data
      * @param important If true, packet gets sequence ID and reliability tracking
-     * @return std::unique_ptr<uint8_t[]> Smart pointer to serialized packet data
+     * @return PacketBuffer The serialized packet, header included
+     */
+    PacketBuffer sendPacketBytesSafe(const void *data, size_t data_size, uint8_t packet_type, size_t *output_size, bool important = true);
+
+    /**
+     * @brief Continues a stream whose first packets were received by another manager (Thread-Safe)
+     *
+     * Packets up to seqid count as received and delivered; delivery starts
+     * at seqid + 1. Used when a connection is handed over from a shared
+     * endpoint to its own manager.
+     *
+     * @param seqid Last sequence ID handled elsewhere
+     */
+    void resumeAfter(uint32_t seqid);
+
+    /**
+     * @brief Enables or disables sequencing of received packets (Thread-Safe)
+     *
+     * When disabled, packets are delivered as they arrive, duplicates
+     * included, and no acknowledgement is produced. Meant for an endpoint
+     * receiving from several peers, whose sequence IDs do not form one stream.
+     *
+     * @param enable True (the default) to acknowledge, reorder and deduplicate
      */
-    std::unique_ptr<uint8_t[]> sendPacketBytesSafe(const void *data, size_t data_size, uint8_t packet_type, size_t *output_size, bool important = true);
+    void setSequencingEnabled(bool enable);
 
     /**
-     * @brief Handles acknowledgment of missing packets (Thread-Safe)
+     * @brief Queues a header-only acknowledgement right away (Thread-Safe)
      *
-     * Processes missed packet notifications and initiates retransmission
-     * of important packets that were not acknowledged by the receiver.
+     * Acknowledgements normally ride on outgoing packets, or go alone once
+     * they waited PACKET_ACK_DELAY_MS; this sends the current receipts and
+     * missing packets without waiting. Does nothing before any packet was
+     * received.
      */
     void ackMissing();
 
@@ -169,7 +299,9 @@ public:
      * @brief Retrieves all received packets from the buffer (Thread-Safe)
      *
      * Returns and clears the buffer of packets that have been received
-     * and processed, ready for application-level handling.
+     * and processed, ready for application-level handling. Important
+     * packets come in sequence order, each once; packets still waiting
+     * for an earlier one are kept for a later call.
      *
      * @return std::vector<std::unique_ptr<packet_t>> Vector of received packets
      */
@@ -179,12 +311,29 @@ public:
      * @brief Retrieves all packets queued for transmission (Thread-Safe)
      *
      * Returns and clears the buffer of packets that are ready to be
-     * sent over the network.
+     * sent over the network. Every packet is stamped with the current
+     * acknowledgement; if there is nothing to send and an acknowledgement
+     * is due, a header-only one (type 0, seqid 0) is returned.
      *
      * @return std::vector<std::unique_ptr<packet_t>> Vector of packets to send
      */
     std::vector<std::unique_ptr<packet_t> > fetchPacketsToSend();
 
+    /**
+     * @brief Retrieves the datagrams to put on the wire (Thread-Safe)
+     *
+     * Same as fetchPacketsToSend(), but consecutive small packets for the
+     * same address are packed into PACKET_TYPE_BUNDLE packets of at most
+     * the MTU, one sub-header per message. The bundle itself has no
+     * sequence ID: each message keeps its own, for acknowledgement,
+     * retransmission and ordering, and the bundle header carries the
+     * acknowledgement once. Compressed packets, packets too large to
+     * share a datagram and lone packets are returned unchanged.
+     *
+     * @return std::vector<std::unique_ptr<packet_t>> Datagrams to send, in order
+     */
+    std::vector<std::unique_ptr<packet_t> > fetchDatagramsToSend();
+
     /**
      * @brief Gets the current send sequence ID (Thread-Safe)
      * @return uint32_t Current sequence ID for outgoing packets
@@ -205,13 +354,19 @@ public:
 
     /**
      * @brief Gets a copy of the transmission history buffer (Thread-Safe)
-     * @return std::vector<packet_t> Copy of sent packet history
+     * @return std::vector<packet_t> Copy of sent packet history, sharing the payloads
      */
     [[nodiscard]] std::vector<packet_t> _get_history_sent() const;
 
     /**
-     * @brief Gets a copy of the list of missed packet sequence IDs (Thread-Safe)
-     * @return std::vector<uint32_t> Copy of missed packet sequence IDs
+     * @brief Gets the number of buffer bytes held by the transmission history (Thread-Safe)
+     * @return size_t Wire size of every packet kept for retransmission
+     */
+    [[nodiscard]] size_t _get_history_bytes() const;
+
+    /**
+     * @brief Gets the sequence IDs missing from the acknowledgement window (Thread-Safe)
+     * @return std::vector<uint32_t> Missing sequence IDs, newest first
      */
     [[nodiscard]] std::vector<uint32_t> _get_missed_packets() const;
 
@@ -243,6 +398,28 @@ public:
      */
     [[nodiscard]] bool isCompressionEnabled() const;
 
+    /**
+     * @brief Sets the largest datagram fetchDatagramsToSend() builds (Thread-Safe)
+     *
+     * @param mtu Datagram size budget in bytes, header included (default
+     * PACKET_DEFAULT_MTU); a budget too small for two messages disables coalescing
+     */
+    void setMtu(size_t mtu);
+
+    /**
+     * @brief Sets how much the transmission history may hold (Thread-Safe)
+     *
+     * The history is a ring of max_packets slots indexed by sequence ID, so
+     * a packet older than max_packets sequence IDs can no longer be resent.
+     * When the packets held take more than max_bytes, the oldest are
+     * dropped, the newest one is always kept. Changing the packet count
+     * empties the history.
+     *
+     * @param max_packets Number of slots, at least 1 (default PACKET_HISTORY_SIZE)
+     * @param max_bytes Byte budget (default PACKET_HISTORY_BYTES)
+     */
+    void setHistoryLimits(size_t max_packets, size_t max_bytes);
+
 private:
     /**
      * @brief Current sequence ID for outgoing packets
@@ -260,14 +437,96 @@ private:
     uint32_t _auth_key = 0;
 
     /**
-     * @brief History of sent packets for retransmission tracking
+     * @brief History of sent packets for retransmission tracking, sharing the sent buffers
+     *
+     * Ring indexed by seqid % size(); a slot whose header.seqid differs
+     * from the one looked up is empty or holds an older packet.
      */
     std::vector<packet_t> _history_sent;
 
     /**
-     * @brief List of missed packet sequence IDs awaiting retransmission
+     * @brief Oldest and newest sequence IDs that may be in the history
+     */
+    uint32_t _history_oldest = 0;
+    uint32_t _history_newest = 0;
+
+    /**
+     * @brief Number of packets and of buffer bytes in the history
+     */
+    size_t _history_count = 0;
+    size_t _history_bytes = 0;
+
+    /**
+     * @brief Byte budget of the history
+     */
+    size_t _history_max_bytes = PACKET_HISTORY_BYTES;
+
+    /**
+     * @brief Ack value at which each history slot was last resent, 0 if never
+     */
+    std::vector<uint32_t> _history_resent;
+
+    /**
+     * @brief When each history slot was last handed out for sending
      */
-    std::vector<uint32_t> _missed_packets;
+    std::vector<std::chrono::steady_clock::time_point> _history_sent_at;
+
+    /**
+     * @brief Smoothed round-trip time, measured on packets acknowledged without being resent
+     */
+    std::chrono::steady_clock::duration _rtt = std::chrono::milliseconds(PACKET_INITIAL_RTT_MS);
+
+    /**
+     * @brief When the history is next scanned for packets waiting too long for their acknowledgement
+     */
+    std::chrono::steady_clock::time_point _resend_check_at;
+
+    /**
+     * @brief Receipt of the PACKET_ACK_BITS sequence IDs before _recv_seqid, sent as ack_bits
+     *
+     * A clear bit is a missing packet.
+     */
+    uint64_t _recv_bits = 0;
+
+    /**
+     * @brief Latest acknowledgement received from the peer
+     */
+    uint32_t _peer_ack = 0;
+
+    /**
+     * @brief Whether receipts happened since the last acknowledgement went out
+     */
+    bool _ack_pending = false;
+
+    /**
+     * @brief Whether the pending acknowledgement reports a loss and must not wait
+     */
+    bool _ack_urgent = false;
+
+    /**
+     * @brief When the pending acknowledgement started waiting
+     */
+    std::chrono::steady_clock::time_point _ack_pending_since;
+
+    /**
+     * @brief Important packets received ahead of _deliver_next, indexed by seqid % PACKET_REORDER_WINDOW
+     */
+    std::vector<std::unique_ptr<packet_t> > _reorder_slots;
+
+    /**
+     * @brief Bit i set when sequence ID _deliver_next + i waits in _reorder_slots
+     */
+    uint64_t _reorder_bits = 0;
+
+    /**
+     * @brief Next sequence ID to deliver
+     */
+    uint32_t _deliver_next = 1;
+
+    /**
+     * @brief Whether received packets are acknowledged, reordered and deduplicated
+     */
+    bool _sequencing_enabled = true;
 
     /**
      * @brief Buffer for received packets awaiting processing
@@ -289,6 +548,11 @@ private:
      */
     bool _compression_enabled = true;
 
+    /**
+     * @brief Datagram size budget of fetchDatagramsToSend()
+     */
+    size_t _mtu = PACKET_DEFAULT_MTU;
+
     /**
      * @brief Resends a packet with the specified sequence ID (Internal, assumes lock held)
      *
@@ -300,6 +564,104 @@ private:
      */
     bool _resendPacket(uint32_t seqid);
 
+    /**
+     * @brief Stores a sent packet in the history ring (Internal, assumes lock held)
+     *
+     * Replaces whatever packet occupied the slot of its sequence ID, then
+     * drops the oldest packets until the byte budget is met. A retransmission
+     * only restarts the wait for its acknowledgement.
+     *
+     * @param packet Important packet (seqid != 0) that was just handed out for sending
+     * @param now Time the packet was handed out
+     */
+    void _storeHistory(const packet_t &packet, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Resends the packets whose acknowledgement is overdue (Internal, assumes lock held)
+     *
+     * Covers the losses acknowledgements cannot report, such as the last
+     * packets of a burst or a peer that stopped acknowledging. Scans the
+     * history at most every PACKET_RESEND_MIN_MS / 2 milliseconds.
+     *
+     * @param now Current time
+     */
+    void _resendExpired(std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Records the receipt of an important packet in the acknowledgement window (Internal, assumes lock held)
+     *
+     * @param seqid Sequence ID received, not 0
+     */
+    void _recordReceived(uint32_t seqid);
+
+    /**
+     * @brief Places an important packet in the reorder window (Internal, assumes lock held)
+     *
+     * Records the receipt, drops duplicates, then delivers the packets that
+     * became consecutive. A packet beyond the window is refused without
+     * receipt: the window never moves past a hole, the peer resends it.
+     *
+     * @param packet Received packet with a non-zero seqid
+     */
+    void _reorderPacket(std::unique_ptr<packet_t> packet);
+
+    /**
+     * @brief Packs packets into bundles of at most mtu bytes
+     *
+     * @param packets Packets in sending order, stamped with the acknowledgement
+     * @param mtu Datagram size budget, header included
+     * @return std::vector<std::unique_ptr<packet_t>> Bundles and packets left alone, in order
+     */
+    static std::vector<std::unique_ptr<packet_t> > _coalescePackets(std::vector<std::unique_ptr<packet_t> > packets,
+                                                                   size_t mtu);
+
+    /**
+     * @brief Splits a received bundle into its messages
+     *
+     * @param bundle Decoded PACKET_TYPE_BUNDLE packet
+     * @return std::vector<std::unique_ptr<packet_t>> The messages, with the bundle address and auth
+     * @throws std::runtime_error if a message overflows the bundle
+     */
+    static std::vector<std::unique_ptr<packet_t> > _splitBundle(const packet_t &bundle);
+
+    /**
+     * @brief Moves the packet of _deliver_next, if any, to the received buffer and advances (Internal, assumes lock held)
+     */
+    void _deliverNext();
+
+    /**
+     * @brief Marks sequence ID 0 as arrived when delivery reaches it on wraparound (Internal, assumes lock held)
+     */
+    void _skipZeroSeqid();
+
+    /**
+     * @brief Applies an acknowledgement from the peer (Internal, assumes lock held)
+     *
+     * Acknowledged packets leave the history. Packets reported missing are
+     * resent, at most once every PACKET_RESEND_DISTANCE sequence IDs. The others
+     * stay until acknowledged or evicted, and _resendExpired() retries them.
+     * Packets older than the window were received, since the peer refuses
+     * packets beyond its reorder window.
+     * The acknowledgement of a packet sent once updates the round-trip time.
+     *
+     * @param ack Latest sequence ID received by the peer
+     * @param ack_bits Receipts of the sequence IDs before ack
+     */
+    void _handleAck(uint32_t ack, uint64_t ack_bits);
+
+    /**
+     * @brief Builds a header-only acknowledgement (Internal, assumes lock held)
+     * @return std::unique_ptr<packet_t> Type 0 packet without sequence ID nor payload
+     */
+    std::unique_ptr<packet_t> _makeAckPacket() const;
+
+    /**
+     * @brief Empties one history slot if it holds the given sequence ID (Internal, assumes lock held)
+     *
+     * @param seqid Sequence ID to forget
+     */
+    void _forgetHistory(uint32_t seqid);
+
     /**
      * @brief Internal packet processing handler (Internal, assumes lock held)
      *
@@ -310,22 +672,36 @@ private:
      */
     void _handlePacket(std::unique_ptr<packet_t> packet);
 
+    /**
+     * @brief Parses a serialized packet held in a pooled buffer
+     *
+     * An uncompressed payload stays in the buffer; a compressed one is
+     * inflated into a new pooled buffer.
+     *
+     * @param wire The serialized packet, header included
+     * @param packet Packet to fill
+     * @throws std::runtime_error if the packet is truncated or cannot be decompressed
+     */
+    static void _decodePacket(PacketBuffer wire, packet_t &packet);
+
     /**
      * @brief Compress data using zlib
      * @param data Pointer to data to compress
      * @param size Size of data to compress
-     * @return Compressed data as vector
+     * @param output Destination, at least compressBound(size) bytes
+     * @return Compressed size
      */
-    static std::vector<unsigned char> compress_data(const void* data, size_t size);
+    static size_t compress_data(const void* data, size_t size, uint8_t *output);
 
     /**
      * @brief Decompress data using zlib
      * @param data Pointer to compressed data
      * @param compressed_size Size of compressed data
+     * @param output Destination, at least original_size bytes
      * @param original_size Expected size after decompression
-     * @return Decompressed data as vector
+     * @return Decompressed size
      */
-    static std::vector<unsigned char> decompress_data(const void* data, size_t compressed_size, size_t original_size);
+    static size_t decompress_data(const void* data, size_t compressed_size, uint8_t *output, size_t original_size);
 
 
 };
@@ -0,0 +1,173 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Pooled reference-counted packet buffers
+*/
+
+#include "packetbuffer.h"
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Smallest pooled payload capacity; classes double up to the largest
+     */
+    constexpr size_t SMALLEST_CLASS = 64;
+
+    /**
+     * @brief Number of size classes, 64 bytes to 64 KiB
+     */
+    constexpr uint32_t CLASS_COUNT = 11;
+
+    /**
+     * @brief Size class of blocks allocated outside of the pool
+     */
+    constexpr uint32_t UNPOOLED = CLASS_COUNT;
+
+    /**
+     * @brief Free blocks kept per class; extra blocks are freed
+     */
+    constexpr size_t MAX_FREE_PER_CLASS = 256;
+
+    struct size_class_t {
+        std::mutex mutex;
+        std::vector<void *> free_blocks;
+    };
+
+    /**
+     * @brief Free lists of every size class
+     *
+     * Never destroyed, so buffers held by static objects can still be
+     * released during program exit.
+     */
+    size_class_t *pool() {
+        static size_class_t *classes = new size_class_t[CLASS_COUNT];
+        return classes;
+    }
+}
+
+PacketBuffer PacketBuffer::allocate(size_t payload_size) {
+    uint32_t size_class = 0;
+    size_t capacity = SMALLEST_CLASS;
+    while (capacity < payload_size && size_class < CLASS_COUNT) {
+        capacity <<= 1;
+        ++size_class;
+    }
+    if (size_class == CLASS_COUNT) {
+        size_class = UNPOOLED;
+        capacity = payload_size;
+    }
+
+    void *memory = nullptr;
+    if (size_class != UNPOOLED) {
+        size_class_t &free_list = pool()[size_class];
+        std::lock_guard<std::mutex> lock(free_list.mutex);
+        if (!free_list.free_blocks.empty()) {
+            memory = free_list.free_blocks.back();
+            free_list.free_blocks.pop_back();
+        }
+    }
+    if (!memory) {
+        memory = ::operator new(_STORAGE_OFFSET + PACKET_BUFFER_HEADROOM + capacity);
+    }
+
+    block_t *block = new (memory) block_t;
+    block->refs.store(1, std::memory_order_relaxed);
+    block->size_class = size_class;
+    block->capacity = capacity;
+    block->size = payload_size;
+    return PacketBuffer(block);
+}
+
+PacketBuffer::PacketBuffer(const PacketBuffer &other) noexcept : _block(other._block) {
+    if (_block) {
+        _block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PacketBuffer::PacketBuffer(PacketBuffer &&other) noexcept : _block(std::exchange(other._block, nullptr)) {
+}
+
+PacketBuffer &PacketBuffer::operator=(const PacketBuffer &other) noexcept {
+    if (_block != other._block) {
+        PacketBuffer copy(other);
+        std::swap(_block, copy._block);
+    }
+    return *this;
+}
+
+PacketBuffer &PacketBuffer::operator=(PacketBuffer &&other) noexcept {
+    if (this != &other) {
+        _release();
+        _block = std::exchange(other._block, nullptr);
+    }
+    return *this;
+}
+
+PacketBuffer::~PacketBuffer() {
+    _release();
+}
+
+void PacketBuffer::_release() {
+    block_t *block = std::exchange(_block, nullptr);
+    if (!block || block->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    const uint32_t size_class = block->size_class;
+    block->~block_t();
+    if (size_class != UNPOOLED) {
+        size_class_t &free_list = pool()[size_class];
+        std::lock_guard<std::mutex> lock(free_list.mutex);
+        if (free_list.free_blocks.size() < MAX_FREE_PER_CLASS) {
+            free_list.free_blocks.push_back(block);
+            return;
+        }
+    }
+    ::operator delete(block);
+}
+
+uint8_t *PacketBuffer::bytes() const {
+    return _block ? reinterpret_cast<uint8_t *>(_block) + _STORAGE_OFFSET : nullptr;
+}
+
+size_t PacketBuffer::size() const {
+    return _block ? PACKET_BUFFER_HEADROOM + _block->size : 0;
+}
+
+uint8_t *PacketBuffer::payload() const {
+    return _block ? bytes() + PACKET_BUFFER_HEADROOM : nullptr;
+}
+
+size_t PacketBuffer::payloadSize() const {
+    return _block ? _block->size : 0;
+}
+
+size_t PacketBuffer::capacity() const {
+    return _block ? _block->capacity : 0;
+}
+
+void PacketBuffer::resize(size_t payload_size) {
+    if (!_block || payload_size > _block->capacity) {
+        throw std::length_error("Packet buffer resized past its capacity");
+    }
+    _block->size = payload_size;
+}
+
+long PacketBuffer::useCount() const {
+    return _block ? static_cast<long>(_block->refs.load(std::memory_order_relaxed)) : 0;
+}
+
+size_t PacketBuffer::pooledBlocks() {
+    size_t count = 0;
+    for (uint32_t i = 0; i < CLASS_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(pool()[i].mutex);
+        count += pool()[i].free_blocks.size();
+    }
+    return count;
+}
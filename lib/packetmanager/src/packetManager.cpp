@@ -23,7 +23,9 @@
     #include <arpa/inet.h>
 #endif
 
-PacketManager::PacketManager() : _send_seqid(0), _recv_seqid(0) {
+PacketManager::PacketManager() : _send_seqid(0), _recv_seqid(0), _history_sent(PACKET_HISTORY_SIZE),
+                                 _history_resent(PACKET_HISTORY_SIZE, 0), _history_sent_at(PACKET_HISTORY_SIZE),
+                                 _reorder_slots(PACKET_REORDER_WINDOW) {
 }
 
 PacketManager::~PacketManager() {
@@ -34,65 +36,99 @@ packet_t PacketManager::deserializePacket(const uint8_t *data, size_t size, pack
     if (size < sizeof(packet_header_t)) {
         throw std::runtime_error("Data size is smaller than packet header size");
     }
-    std::memcpy(&packet.header, data, sizeof(packet_header_t));
+    PacketBuffer wire = PacketBuffer::allocate(size - sizeof(packet_header_t));
+    std::memcpy(wire.bytes(), data, size);
+    _decodePacket(std::move(wire), packet);
+    return packet;
+}
+
+void PacketManager::_decodePacket(PacketBuffer wire, packet_t &packet) {
+    if (wire.size() < sizeof(packet_header_t)) {
+        throw std::runtime_error("Data size is smaller than packet header size");
+    }
+    std::memcpy(&packet.header, wire.bytes(), sizeof(packet_header_t));
 
     // Validate that the data_size field matches the actual data received
     size_t expected_total_size = sizeof(packet_header_t) + packet.header.data_size;
-    if (size != expected_total_size) {
+    if (wire.size() != expected_total_size) {
         throw std::runtime_error("Packet size mismatch: expected " + std::to_string(expected_total_size) +
-                                 ", got " + std::to_string(size));
+                                 ", got " + std::to_string(wire.size()));
     }
 
-    if (packet.header.data_size > 0) {
-        const uint8_t* payload_data = data + sizeof(packet_header_t);
-
-        // Check if data is compressed (original_size != 0)
-        if (packet.header.original_size > 0) {
-            // Data is compressed - decompress it
-            try {
-                auto decompressed = decompress_data(payload_data, packet.header.data_size, packet.header.original_size);
-
-                // Allocate buffer and copy decompressed data
-                packet.data = new uint8_t[decompressed.size()];
-                std::memcpy(packet.data, decompressed.data(), decompressed.size());
-
-                // Update data_size to reflect decompressed size for application use
-                packet.header.data_size = decompressed.size();
-                packet.header.original_size = 0; // Clear to indicate data is now uncompressed
-            } catch (const std::exception& e) {
-                throw std::runtime_error("Failed to decompress packet data: " + std::string(e.what()));
-            }
-        } else {
-            // Data is not compressed - use as-is
-            packet.data = new uint8_t[packet.header.data_size];
-            std::memcpy(packet.data, payload_data, packet.header.data_size);
+    if (packet.header.data_size > 0 && packet.header.original_size > 0) {
+        // Data is compressed - inflate it into its own buffer
+        try {
+            PacketBuffer inflated = PacketBuffer::allocate(packet.header.original_size);
+            size_t inflated_size = decompress_data(wire.payload(), packet.header.data_size, inflated.payload(),
+                                                   packet.header.original_size);
+            inflated.resize(inflated_size);
+
+            // Update data_size to reflect decompressed size for application use
+            packet.header.data_size = inflated_size;
+            packet.header.original_size = 0; // Clear to indicate data is now uncompressed
+            packet.buffer = std::move(inflated);
+        } catch (const std::exception& e) {
+            throw std::runtime_error("Failed to decompress packet data: " + std::string(e.what()));
         }
     } else {
-        packet.data = nullptr;
+        // Data is not compressed - the received bytes are the payload
+        packet.buffer = std::move(wire);
     }
-    return packet;
 }
 
 std::vector<uint8_t> PacketManager::serializePacket(const packet_t &packet) {
     std::vector<uint8_t> buffer(sizeof(packet_header_t) + packet.header.data_size);
     std::memcpy(buffer.data(), &packet.header, sizeof(packet_header_t));
-    if (packet.header.data_size > 0 && packet.data) {
-        std::memcpy(buffer.data() + sizeof(packet_header_t), packet.data, packet.header.data_size);
+    if (packet.header.data_size > 0 && packet.data()) {
+        std::memcpy(buffer.data() + sizeof(packet_header_t), packet.data(), packet.header.data_size);
     }
     return buffer;
 }
 
+const uint8_t *PacketManager::wireBytes(packet_t &packet, size_t *size) {
+    if (!packet.buffer) {
+        packet.buffer = PacketBuffer::allocate(0);
+    }
+    std::memcpy(packet.buffer.bytes(), &packet.header, sizeof(packet_header_t));
+    if (size != nullptr) {
+        *size = packet.buffer.size();
+    }
+    return packet.buffer.bytes();
+}
+
 void PacketManager::handlePacketBytes(const uint8_t *data, size_t size, sockaddr_in client_addr) {
+    if (size < sizeof(packet_header_t)) {
+        // Invalid packet, ignore it
+        return;
+    }
+    PacketBuffer wire = PacketBuffer::allocate(size - sizeof(packet_header_t));
+    std::memcpy(wire.bytes(), data, size);
+    handlePacketBuffer(std::move(wire), client_addr);
+}
+
+void PacketManager::handlePacketBuffer(PacketBuffer buffer, sockaddr_in client_addr) {
     try {
         // Deserialize the packet and store it in unique_ptr<packet_t>
         std::unique_ptr<packet_t> packet = std::make_unique<packet_t>();
-        deserializePacket(data, size, *packet);
+        _decodePacket(std::move(buffer), *packet);
         packet->header.client_addr[0] = (client_addr.sin_addr.s_addr >> 0) & 0xFF;
         packet->header.client_addr[1] = (client_addr.sin_addr.s_addr >> 8) & 0xFF;
         packet->header.client_addr[2] = (client_addr.sin_addr.s_addr >> 16) & 0xFF;
         packet->header.client_addr[3] = (client_addr.sin_addr.s_addr >> 24) & 0xFF;
         packet->header.client_port = ntohs(client_addr.sin_port);
 
+        if (packet->header.type == PACKET_TYPE_BUNDLE) {
+            // Split before locking, so a malformed bundle is dropped as a whole
+            std::vector<std::unique_ptr<packet_t> > messages = _splitBundle(*packet);
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _handleAck(packet->header.ack, packet->header.ack_bits);
+            for (auto &message: messages) {
+                _handlePacket(std::move(message));
+            }
+            return;
+        }
+
         // Lock before calling _handlePacket
         std::lock_guard<std::mutex> lock(_mutex);
         _handlePacket(std::move(packet));
@@ -102,251 +138,402 @@ void PacketManager::handlePacketBytes(const uint8_t *data, size_t size, sockaddr
     }
 }
 
-std::unique_ptr<uint8_t[]> PacketManager::sendPacketBytesSafe(const void *data, size_t data_size, uint8_t packet_type,
-                                                              size_t *output_size, bool important) {
+PacketBuffer PacketManager::sendPacketBytesSafe(const void *data, size_t data_size, uint8_t packet_type,
+                                                size_t *output_size, bool important) {
     std::lock_guard<std::mutex> lock(_mutex);
 
     packet_header_t header;
     std::unique_ptr<packet_t> packet = std::make_unique<packet_t>();
 
-    header.seqid = important ? ++_send_seqid : 0;
-    header.ack = 0;
+    if (important && ++_send_seqid == 0) {
+        ++_send_seqid; // 0 marks unreliable packets, skip it on wraparound
+    }
+    header.seqid = important ? _send_seqid : 0;
+    header.ack = 0; // Stamped when the packet is handed out for sending
+    header.ack_bits = 0;
     header.type = packet_type;
     header.auth = _auth_key;
     header.original_size = 0; // Will be set if compression is used
     std::memset(&header.client_addr, 0, sizeof(header.client_addr));
     header.client_port = 0;
 
-    void* packet_data = nullptr;
+    // Compress data if compression is enabled and data size is significant (> 32 bytes)
+    bool compress = _compression_enabled && data_size > 32;
+    PacketBuffer buffer = PacketBuffer::allocate(compress ? compressBound(data_size) : data_size);
     size_t packet_data_size = data_size;
 
-    // Compress data if compression is enabled and data size is significant (> 32 bytes)
-    if (_compression_enabled && data_size > 32) {
+    if (compress) {
         try {
-            auto compressed = compress_data(data, data_size);
+            size_t compressed_size = compress_data(data, data_size, buffer.payload());
 
             // Only use compression if it actually reduces size
-            if (compressed.size() < data_size) {
+            if (compressed_size < data_size) {
                 header.original_size = data_size;
-                packet_data_size = compressed.size();
-                packet_data = new uint8_t[compressed.size()];
-                std::memcpy(packet_data, compressed.data(), compressed.size());
+                packet_data_size = compressed_size;
             } else {
-                // Compression didn't help, use original data
-                header.original_size = 0;
-                packet_data_size = data_size;
-                if (data_size > 0) {
-                    packet_data = new uint8_t[data_size];
-                    std::memcpy(packet_data, data, data_size);
-                }
+                compress = false;
             }
         } catch (const std::exception& e) {
             // Compression failed, use original data
-            header.original_size = 0;
-            packet_data_size = data_size;
-            if (data_size > 0) {
-                packet_data = new uint8_t[data_size];
-                std::memcpy(packet_data, data, data_size);
-            }
-        }
-    } else {
-        // Compression disabled or data too small - use original data
-        if (data_size > 0) {
-            packet_data = new uint8_t[data_size];
-            std::memcpy(packet_data, data, data_size);
+            compress = false;
         }
     }
+    if (!compress && data_size > 0) {
+        std::memcpy(buffer.payload(), data, data_size);
+    }
 
     header.data_size = packet_data_size;
+    buffer.resize(packet_data_size);
     packet->header = header;
-    packet->data = static_cast<uint8_t*>(packet_data);
-
-    // Serialize the packet
-    std::vector<uint8_t> serialized_packet = serializePacket(*packet);
-
-    // Create smart pointer for output data
-    auto output_data = std::make_unique<uint8_t[]>(serialized_packet.size());
-    std::memcpy(output_data.get(), serialized_packet.data(), serialized_packet.size());
+    packet->buffer = buffer;
 
+    // The header goes in the room reserved in front of the payload
+    size_t serialized_size = 0;
+    wireBytes(*packet, &serialized_size);
     if (output_size != nullptr) {
-        *output_size = serialized_packet.size();
+        *output_size = serialized_size;
     }
     // Store the packet in the send buffer
     _buffer_send.push_back(std::move(packet));
 
-    return output_data;
+    return buffer;
 }
 
 std::unique_ptr<packet_t> PacketManager::deserializePacketSafe(const uint8_t *data, size_t size) {
     auto packet = std::make_unique<packet_t>();
+    deserializePacket(data, size, *packet);
+    return packet;
+}
 
-    if (size < sizeof(packet_header_t)) {
-        throw std::runtime_error("Data size is smaller than packet header size");
+void PacketManager::clean() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Buffers go back to the pool once the last packet sharing them is gone
+    std::fill(_history_sent.begin(), _history_sent.end(), packet_t{});
+    _history_oldest = 0;
+    _history_newest = 0;
+    _history_count = 0;
+    _history_bytes = 0;
+    std::fill(_history_resent.begin(), _history_resent.end(), 0);
+    _rtt = std::chrono::milliseconds(PACKET_INITIAL_RTT_MS);
+    _resend_check_at = std::chrono::steady_clock::time_point{};
+    _buffer_received.clear();
+    _buffer_send.clear();
+    _send_seqid = 0;
+    _recv_seqid = 0;
+    _recv_bits = 0;
+    _peer_ack = 0;
+    _ack_pending = false;
+    _ack_urgent = false;
+    for (auto &slot: _reorder_slots) {
+        slot.reset();
     }
-    std::memcpy(&packet->header, data, sizeof(packet_header_t));
+    _reorder_bits = 0;
+    _deliver_next = 1;
+}
 
-    // Validate that the data_size field matches the actual data received
-    size_t expected_total_size = sizeof(packet_header_t) + packet->header.data_size;
-    if (size != expected_total_size) {
-        throw std::runtime_error("Packet size mismatch: expected " + std::to_string(expected_total_size) +
-                                 ", got " + std::to_string(size));
+void PacketManager::resumeAfter(uint32_t seqid) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Packets already received after seqid stay; holes up to seqid are not holes
+    const uint32_t first = seqid + 1;
+    if (first - _deliver_next >= PACKET_REORDER_WINDOW) {
+        // Far ahead, or behind: nothing held can be kept
+        for (auto &slot: _reorder_slots) {
+            slot.reset();
+        }
+        _reorder_bits = 0;
+        _deliver_next = first;
+    }
+    while (_deliver_next != first) {
+        _reorder_slots[_deliver_next % PACKET_REORDER_WINDOW].reset();
+        _reorder_bits >>= 1;
+        _deliver_next++;
+    }
+    _skipZeroSeqid();
+    while (_reorder_bits & 1) {
+        _deliverNext();
     }
 
-    if (packet->header.data_size > 0) {
-        const uint8_t* payload_data = data + sizeof(packet_header_t);
+    if (_recv_seqid == 0 || static_cast<int32_t>(seqid - _recv_seqid) >= 0) {
+        _recv_seqid = seqid;
+        _recv_bits = ~0ULL;
+    } else if (_recv_seqid - seqid <= PACKET_ACK_BITS) {
+        _recv_bits |= ~0ULL << (_recv_seqid - seqid - 1);
+    }
+}
 
-        // Check if data is compressed (original_size != 0)
-        if (packet->header.original_size > 0) {
-            // Data is compressed - decompress it
-            try {
-                auto decompressed = decompress_data(payload_data, packet->header.data_size, packet->header.original_size);
+void PacketManager::setSequencingEnabled(bool enable) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _sequencing_enabled = enable;
+}
 
-                // Allocate buffer and copy decompressed data
-                packet->data = new uint8_t[decompressed.size()];
-                std::memcpy(packet->data, decompressed.data(), decompressed.size());
+void PacketManager::ackMissing() {
+    std::lock_guard<std::mutex> lock(_mutex);
 
-                // Update data_size to reflect decompressed size for application use
-                packet->header.data_size = decompressed.size();
-                packet->header.original_size = 0; // Clear to indicate data is now uncompressed
-            } catch (const std::exception& e) {
-                throw std::runtime_error("Failed to decompress packet data: " + std::string(e.what()));
-            }
-        } else {
-            // Data is not compressed - use as-is
-            packet->data = new uint8_t[packet->header.data_size];
-            std::memcpy(packet->data, payload_data, packet->header.data_size);
-        }
-    } else {
-        packet->data = nullptr;
+    if (_recv_seqid == 0) {
+        return;
     }
+    // Stamped with the current receipts by fetchPacketsToSend()
+    _buffer_send.push_back(_makeAckPacket());
+}
+
+std::unique_ptr<packet_t> PacketManager::_makeAckPacket() const {
+    // Note: This method assumes the mutex is already locked by the caller
+    auto packet = std::make_unique<packet_t>();
+    packet->header.seqid = 0;
+    packet->header.ack = _recv_seqid;
+    packet->header.ack_bits = _recv_bits;
+    packet->header.type = 0;
+    packet->header.auth = _auth_key;
+    std::memset(&packet->header.client_addr, 0, sizeof(packet->header.client_addr));
+    packet->header.client_port = 0;
+    packet->header.data_size = 0;
+    packet->header.original_size = 0;
     return packet;
 }
 
-void PacketManager::clean() {
-    std::lock_guard<std::mutex> lock(_mutex);
+bool PacketManager::_resendPacket(uint32_t seqid) {
+    // Note: This method assumes the mutex is already locked by the caller
+    const packet_t &packet = _history_sent[seqid % _history_sent.size()];
+    if (seqid == 0 || packet.header.seqid != seqid) {
+        return false;
+    }
+    // The retransmission shares the payload kept in the history
+    _buffer_send.push_back(std::make_unique<packet_t>(packet));
+    return true;
+}
 
-    // Clean up history data before clearing
-    for (auto &packet: _history_sent) {
-        if (packet.data) {
-            delete[] static_cast<uint8_t *>(packet.data);
-            packet.data = nullptr;
-        }
+void PacketManager::_forgetHistory(uint32_t seqid) {
+    // Note: This method assumes the mutex is already locked by the caller
+    packet_t &slot = _history_sent[seqid % _history_sent.size()];
+    if (seqid != 0 && slot.header.seqid == seqid) {
+        _history_bytes -= slot.buffer.size();
+        _history_count--;
+        slot = packet_t{};
     }
+}
 
-    // Clean up received buffer data
-    for (auto &packet: _buffer_received) {
-        if (packet && packet->data) {
-            delete[] static_cast<uint8_t *>(packet->data);
-            packet->data = nullptr;
+void PacketManager::_storeHistory(const packet_t &packet, std::chrono::steady_clock::time_point now) {
+    // Note: This method assumes the mutex is already locked by the caller
+    const uint32_t seqid = packet.header.seqid;
+    const uint32_t capacity = static_cast<uint32_t>(_history_sent.size());
+
+    if (_history_sent[seqid % capacity].header.seqid == seqid) {
+        // A retransmission: the slot already shares its payload
+        _history_sent_at[seqid % capacity] = now;
+        return;
+    }
+    if (_peer_ack != 0 && static_cast<int32_t>(_peer_ack - seqid) > PACKET_ACK_BITS) {
+        // Out of the peer acknowledgement window, so already received
+        return;
+    }
+    if (_history_count == 0) {
+        _history_oldest = seqid;
+        _history_newest = seqid;
+    } else if (static_cast<int32_t>(seqid - _history_oldest) < 0) {
+        // Older than anything kept, it could not be resent anyway
+        return;
+    } else if (static_cast<int32_t>(seqid - _history_newest) > 0) {
+        _history_newest = seqid;
+    }
+
+    // Packets more than a ring behind the newest one are dropped
+    if (_history_newest - _history_oldest >= capacity) {
+        const uint32_t lowest = _history_newest - capacity + 1;
+        if (lowest - _history_oldest > capacity) {
+            for (const packet_t &stale: _history_sent) {
+                if (stale.header.seqid != 0 && static_cast<int32_t>(stale.header.seqid - lowest) < 0) {
+                    _forgetHistory(stale.header.seqid);
+                }
+            }
+        } else {
+            while (_history_oldest != lowest) {
+                _forgetHistory(_history_oldest++);
+            }
         }
+        _history_oldest = lowest;
     }
 
-    // Clean up send buffer data
-    for (auto &packet: _buffer_send) {
-        if (packet && packet->data) {
-            delete[] static_cast<uint8_t *>(packet->data);
-            packet->data = nullptr;
+    packet_t &slot = _history_sent[seqid % capacity];
+    _forgetHistory(slot.header.seqid);
+    slot = packet;
+    _history_resent[seqid % capacity] = 0;
+    _history_sent_at[seqid % capacity] = now;
+    _history_bytes += slot.buffer.size();
+    _history_count++;
+
+    // Drop the oldest packets past the byte budget; the oldest sequence ID only moves forward
+    while (_history_bytes > _history_max_bytes && _history_oldest != _history_newest) {
+        _forgetHistory(_history_oldest++);
+    }
+}
+
+void PacketManager::_recordReceived(uint32_t seqid) {
+    // Note: This method assumes the mutex is already locked by the caller
+    // Sequence IDs start at 1: before any receipt, _recv_seqid is 0 and everything is newer
+    if (_recv_seqid == 0 || static_cast<int32_t>(seqid - _recv_seqid) > 0) {
+        // New latest packet: the window slides, the previous latest becomes a receipt bit
+        const uint32_t shift = seqid - _recv_seqid;
+        _recv_bits = shift >= PACKET_ACK_BITS ? 0 : _recv_bits << shift;
+        if (_recv_seqid != 0 && shift <= PACKET_ACK_BITS) {
+            _recv_bits |= 1ULL << (shift - 1);
+        }
+        // Every sequence ID jumped over is a loss to report without delay
+        if (shift > 1) {
+            _ack_urgent = true;
         }
+        _recv_seqid = seqid;
+    } else if (seqid != _recv_seqid && _recv_seqid - seqid <= PACKET_ACK_BITS) {
+        // A late or resent packet fills its hole
+        _recv_bits |= 1ULL << (_recv_seqid - seqid - 1);
     }
 
-    _history_sent.clear();
-    _missed_packets.clear();
-    _buffer_received.clear();
-    _buffer_send.clear();
-    _send_seqid = 0;
-    _recv_seqid = 0;
+    if (!_ack_pending) {
+        _ack_pending = true;
+        _ack_pending_since = std::chrono::steady_clock::now();
+    }
 }
 
-void PacketManager::ackMissing() {
-    std::lock_guard<std::mutex> lock(_mutex);
+void PacketManager::_handleAck(uint32_t ack, uint64_t ack_bits) {
+    // Note: This method assumes the mutex is already locked by the caller
+    if (ack == 0 || (_peer_ack != 0 && static_cast<int32_t>(ack - _peer_ack) < 0)) {
+        // Nothing received by the peer yet, or an older acknowledgement arriving late
+        return;
+    }
+    if (static_cast<int32_t>(ack - _send_seqid) > 0) {
+        // Acknowledges packets never sent: a peer still numbering from a previous session
+        return;
+    }
+    _peer_ack = ack;
 
-    packet_header_t header;
-    packet_t packet;
-    header.seqid = 0;
-    header.type = 0;
-    header.auth = _auth_key;
-    header.ack = 0;
-    header.data_size = 0;
+    const auto now = std::chrono::steady_clock::now();
+    const uint32_t capacity = static_cast<uint32_t>(_history_sent.size());
+    if (_history_sent[ack % capacity].header.seqid == ack && _history_resent[ack % capacity] == 0) {
+        // Sent once, so the acknowledgement cannot be for an earlier copy
+        _rtt += (now - _history_sent_at[ack % capacity] - _rtt) / 8;
+    }
+    _forgetHistory(ack);
+
+    for (uint32_t i = 0; i < PACKET_ACK_BITS && ack - 1 - i != 0; i++) {
+        const uint32_t seqid = ack - 1 - i;
+        if (ack_bits & (1ULL << i)) {
+            _forgetHistory(seqid);
+            continue;
+        }
+        // Missing on the peer side: resend, unless that was done recently
+        uint32_t &resent_at = _history_resent[seqid % capacity];
+        if (resent_at == 0 || static_cast<int32_t>(ack - resent_at) >= PACKET_RESEND_DISTANCE) {
+            if (_resendPacket(seqid)) {
+                resent_at = ack;
+                // Queued already: the timeout starts over
+                _history_sent_at[seqid % capacity] = now;
+            }
+        }
+    }
 
-    for (auto seqid: _missed_packets) {
-        header.ack = seqid;
-        packet.header = header;
-        packet.data = nullptr;
-        _buffer_send.push_back(std::make_unique<packet_t>(packet));
+    // The peer never acknowledges further than a window past its oldest hole: older packets were received
+    while (_history_count > 0 && static_cast<int32_t>(ack - _history_oldest) > PACKET_ACK_BITS) {
+        _forgetHistory(_history_oldest++);
     }
-    _missed_packets.clear();
 }
 
-bool PacketManager::_resendPacket(uint32_t seqid) {
+void PacketManager::_resendExpired(std::chrono::steady_clock::time_point now) {
     // Note: This method assumes the mutex is already locked by the caller
-    for (const packet_t &packet: _history_sent) {
-        if (packet.header.seqid == seqid) {
-            // Create a proper deep copy of the packet for retransmission
-            std::unique_ptr<packet_t> retrans_packet = std::make_unique<packet_t>();
-            retrans_packet->header = packet.header;
-
-            // Deep copy the data if it exists
-            if (packet.header.data_size > 0 && packet.data) {
-                retrans_packet->data = new uint8_t[packet.header.data_size];
-                std::memcpy(retrans_packet->data, packet.data, packet.header.data_size);
-            } else {
-                retrans_packet->data = nullptr;
-            }
+    if (now < _resend_check_at) {
+        return;
+    }
+    _resend_check_at = now + std::chrono::milliseconds(PACKET_RESEND_MIN_MS / 2);
 
-            _buffer_send.push_back(std::move(retrans_packet));
-            return true;
+    const uint32_t capacity = static_cast<uint32_t>(_history_sent.size());
+    const std::chrono::steady_clock::duration timeout =
+        std::max<std::chrono::steady_clock::duration>(2 * _rtt, std::chrono::milliseconds(PACKET_RESEND_MIN_MS));
+
+    // Acknowledged packets at the front no longer need to be scanned
+    while (_history_count > 0 && _history_sent[_history_oldest % capacity].header.seqid != _history_oldest) {
+        _history_oldest++;
+    }
+    const uint32_t span = _history_newest - _history_oldest;
+    for (uint32_t i = 0; _history_count > 0 && i <= span; i++) {
+        const uint32_t seqid = _history_oldest + i;
+        if (_history_sent[seqid % capacity].header.seqid != seqid || now - _history_sent_at[seqid % capacity] < timeout) {
+            continue;
+        }
+        if (_resendPacket(seqid)) {
+            // Holds back the resend on acknowledgements too; 0 would mean never resent
+            _history_resent[seqid % capacity] = _peer_ack != 0 ? _peer_ack : 1;
         }
     }
-    return false;
 }
 
 void PacketManager::_handlePacket(std::unique_ptr<packet_t> packet) {
     // Note: This method assumes the mutex is already locked by the caller
 
-    // Check if this is an ACK packet, handle it separately
-    if (packet->header.ack != 0) {
-        _resendPacket(packet->header.ack);
+    // Every packet acknowledges what its sender received
+    _handleAck(packet->header.ack, packet->header.ack_bits);
+
+    // A header-only acknowledgement carries nothing else
+    if (packet->header.seqid == 0 && packet->header.type == 0 && packet->header.data_size == 0) {
         return;
     }
 
-    // If this is a missed packet, remove it from the missed list
-    _missed_packets.erase(std::remove(_missed_packets.begin(), _missed_packets.end(), packet->header.seqid),
-                          _missed_packets.end());
+    // Unreliable packets, or every packet of an endpoint shared by several peers, are delivered as they come
+    if (packet->header.seqid == 0 || !_sequencing_enabled) {
+        _buffer_received.push_back(std::move(packet));
+        return;
+    }
 
-    // Update highest received sequence ID and detect missing packets
-    if (packet->header.seqid != 0 && packet->header.seqid > _recv_seqid) {
-        // Declare as missed all packets between last received and this one
-        for (uint32_t i = _recv_seqid + 1; i < packet->header.seqid; i++) {
-            _missed_packets.push_back(i);
-        }
-        _recv_seqid = packet->header.seqid;
-
-        // Acknowledge all missed packets
-        packet_header_t header;
-        packet_t ack_packet;
-        header.seqid = 0;
-        header.type = 0;
-        header.auth = _auth_key;
-        header.ack = 0;
-        header.data_size = 0;
-
-        for (auto seqid: _missed_packets) {
-            header.ack = seqid;
-            ack_packet.header = header;
-            ack_packet.data = nullptr;
-            _buffer_send.push_back(std::make_unique<packet_t>(ack_packet));
+    _reorderPacket(std::move(packet));
+}
+
+void PacketManager::_reorderPacket(std::unique_ptr<packet_t> packet) {
+    // Note: This method assumes the mutex is already locked by the caller
+    const uint32_t seqid = packet->header.seqid;
+    const uint32_t offset = seqid - _deliver_next;
+
+    if (static_cast<int32_t>(offset) >= 0 && offset >= PACKET_REORDER_WINDOW) {
+        // Too far ahead of the oldest hole: refused without receipt, so the peer keeps it and resends
+        // it once the hole is filled. The hole is reported again at once.
+        _ack_urgent = true;
+        if (!_ack_pending) {
+            _ack_pending = true;
+            _ack_pending_since = std::chrono::steady_clock::now();
         }
-        _missed_packets.clear();
+        return;
     }
 
-    // Always store the packet in the received buffer
-    _buffer_received.push_back(std::move(packet));
+    _recordReceived(seqid);
+    if (static_cast<int32_t>(offset) < 0 || (_reorder_bits >> offset) & 1) {
+        // Already delivered, or already waiting: a retransmission that raced the original
+        return;
+    }
+
+    _reorder_slots[seqid % PACKET_REORDER_WINDOW] = std::move(packet);
+    _reorder_bits |= 1ULL << offset;
+
+    // Release the run of consecutive packets now complete
+    while (_reorder_bits & 1) {
+        _deliverNext();
+    }
+}
+
+void PacketManager::_deliverNext() {
+    // Note: This method assumes the mutex is already locked by the caller
+    std::unique_ptr<packet_t> &slot = _reorder_slots[_deliver_next % PACKET_REORDER_WINDOW];
+    if (slot) {
+        _buffer_received.push_back(std::move(slot));
+    }
+    _reorder_bits >>= 1;
+    _deliver_next++;
+    _skipZeroSeqid();
+}
 
-    // Sort the received buffer by seqid
-    std::sort(_buffer_received.begin(), _buffer_received.end(),
-              [](const std::unique_ptr<packet_t> &a, const std::unique_ptr<packet_t> &b) {
-                  return a->header.seqid < b->header.seqid;
-              });
+void PacketManager::_skipZeroSeqid() {
+    // Note: This method assumes the mutex is already locked by the caller
+    if (_deliver_next == 0) {
+        // Never sent as an important packet: count it as arrived, with nothing to deliver
+        _reorder_bits |= 1;
+    }
 }
 
 std::vector<std::unique_ptr<packet_t> > PacketManager::fetchReceivedPackets() {
@@ -360,37 +547,143 @@ std::vector<std::unique_ptr<packet_t> > PacketManager::fetchReceivedPackets() {
 std::vector<std::unique_ptr<packet_t> > PacketManager::fetchPacketsToSend() {
     std::lock_guard<std::mutex> lock(_mutex);
 
+    const auto now = std::chrono::steady_clock::now();
+    _resendExpired(now);
+
     std::vector<std::unique_ptr<packet_t> > tmp = std::move(_buffer_send);
     _buffer_send.clear();
 
-    // Fill the packets history
+    // Receipts go alone only when nothing else leaves soon enough to carry them
+    if (tmp.empty() && _ack_pending &&
+        (_ack_urgent || now - _ack_pending_since >= std::chrono::milliseconds(PACKET_ACK_DELAY_MS))) {
+        tmp.push_back(_makeAckPacket());
+    }
+    if (!tmp.empty()) {
+        _ack_pending = false;
+        _ack_urgent = false;
+    }
+
+    // Stamp the acknowledgement and fill the packets history
     for (auto &packet: tmp) {
-        if (_history_sent.size() >= PACKET_HISTORY_SIZE) {
-            // Properly clean up the oldest packet before removing it
-            if (_history_sent.front().data) {
-                delete[] static_cast<uint8_t *>(_history_sent.front().data);
-            }
-            _history_sent.erase(_history_sent.begin());
-        }
+        packet->header.ack = _recv_seqid;
+        packet->header.ack_bits = _recv_bits;
+
         // Skip if not important
         if (packet->header.seqid == 0)
             continue;
-        // Create a copy of the packet to store in history
-        packet_t packet_copy;
-        packet_copy.header = packet->header;
-
-        // Copy the data using the data_size from header
-        if (packet->header.data_size > 0 && packet->data) {
-            packet_copy.data = new uint8_t[packet->header.data_size];
-            std::memcpy(packet_copy.data, packet->data, packet->header.data_size);
-        } else {
-            packet_copy.data = nullptr;
+        // The history shares the payload with the packet being sent
+        if (!packet->buffer) {
+            packet->buffer = PacketBuffer::allocate(0);
         }
-        _history_sent.push_back(packet_copy);
+        _storeHistory(*packet, now);
     }
     return tmp;
 }
 
+std::vector<std::unique_ptr<packet_t> > PacketManager::fetchDatagramsToSend() {
+    size_t mtu;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        mtu = _mtu;
+    }
+    return _coalescePackets(fetchPacketsToSend(), mtu);
+}
+
+std::vector<std::unique_ptr<packet_t> > PacketManager::_coalescePackets(std::vector<std::unique_ptr<packet_t> > packets,
+                                                                        size_t mtu) {
+    const size_t budget = mtu > sizeof(packet_header_t) ? mtu - sizeof(packet_header_t) : 0;
+    auto fits = [budget](const packet_t &packet) {
+        // Compressed payloads carry their original size, which the sub-header has no room for
+        return packet.header.original_size == 0 && packet.header.data_size <= UINT16_MAX &&
+               PACKET_MESSAGE_HEADER_SIZE + packet.header.data_size <= budget;
+    };
+    auto same_peer = [](const packet_t &a, const packet_t &b) {
+        return std::memcmp(a.header.client_addr, b.header.client_addr, sizeof(a.header.client_addr)) == 0 &&
+               a.header.client_port == b.header.client_port;
+    };
+
+    std::vector<std::unique_ptr<packet_t> > datagrams;
+    size_t i = 0;
+    while (i < packets.size()) {
+        // Gather the run of packets sharing this datagram
+        size_t end = i;
+        size_t total = 0;
+        while (end < packets.size() && fits(*packets[end]) && same_peer(*packets[i], *packets[end]) &&
+               total + PACKET_MESSAGE_HEADER_SIZE + packets[end]->header.data_size <= budget) {
+            total += PACKET_MESSAGE_HEADER_SIZE + packets[end]->header.data_size;
+            end++;
+        }
+        if (end - i < 2) {
+            // Alone anyway: no sub-header needed
+            datagrams.push_back(std::move(packets[i]));
+            i = std::max(end, i + 1);
+            continue;
+        }
+
+        auto bundle = std::make_unique<packet_t>();
+        bundle->header = packets[i]->header;
+        bundle->header.seqid = 0;
+        bundle->header.type = PACKET_TYPE_BUNDLE;
+        bundle->header.data_size = total;
+        bundle->header.original_size = 0;
+        bundle->buffer = PacketBuffer::allocate(total);
+
+        uint8_t *out = bundle->buffer.payload();
+        for (; i < end; i++) {
+            const packet_header_t &header = packets[i]->header;
+            const uint16_t size = static_cast<uint16_t>(header.data_size);
+            std::memcpy(out, &header.seqid, sizeof(header.seqid));
+            std::memcpy(out + 4, &header.type, sizeof(header.type));
+            std::memcpy(out + 5, &size, sizeof(size));
+            if (size > 0) {
+                std::memcpy(out + PACKET_MESSAGE_HEADER_SIZE, packets[i]->data(), size);
+            }
+            out += PACKET_MESSAGE_HEADER_SIZE + size;
+        }
+        datagrams.push_back(std::move(bundle));
+    }
+    return datagrams;
+}
+
+std::vector<std::unique_ptr<packet_t> > PacketManager::_splitBundle(const packet_t &bundle) {
+    std::vector<std::unique_ptr<packet_t> > messages;
+    const uint8_t *in = static_cast<const uint8_t *>(bundle.data());
+    size_t remaining = bundle.header.data_size;
+
+    while (remaining > 0) {
+        if (remaining < PACKET_MESSAGE_HEADER_SIZE) {
+            throw std::runtime_error("Truncated message header in bundle");
+        }
+        auto message = std::make_unique<packet_t>();
+        uint16_t size;
+        std::memcpy(&message->header.seqid, in, sizeof(message->header.seqid));
+        std::memcpy(&message->header.type, in + 4, sizeof(message->header.type));
+        std::memcpy(&size, in + 5, sizeof(size));
+        if (remaining - PACKET_MESSAGE_HEADER_SIZE < size) {
+            throw std::runtime_error("Message overflows its bundle");
+        }
+
+        // The bundle acknowledgement is handled once, by the caller
+        message->header.ack = 0;
+        message->header.ack_bits = 0;
+        message->header.auth = bundle.header.auth;
+        std::memcpy(message->header.client_addr, bundle.header.client_addr, sizeof(message->header.client_addr));
+        message->header.client_port = bundle.header.client_port;
+        message->header.data_size = size;
+        message->header.original_size = 0;
+        // Each message owns its bytes, so it can outlive its neighbours
+        message->buffer = PacketBuffer::allocate(size);
+        if (size > 0) {
+            std::memcpy(message->buffer.payload(), in + PACKET_MESSAGE_HEADER_SIZE, size);
+        }
+        messages.push_back(std::move(message));
+
+        in += PACKET_MESSAGE_HEADER_SIZE + size;
+        remaining -= PACKET_MESSAGE_HEADER_SIZE + size;
+    }
+    return messages;
+}
+
 // Thread-safe getter implementations
 uint32_t PacketManager::_get_send_seqid() const {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -410,26 +703,33 @@ uint32_t PacketManager::_get_auth_key() const {
 std::vector<packet_t> PacketManager::_get_history_sent() const {
     std::lock_guard<std::mutex> lock(_mutex);
 
-    // Create a deep copy of the history
+    // Oldest first
     std::vector<packet_t> copy;
-    for (const auto &packet : _history_sent) {
-        packet_t packet_copy;
-        packet_copy.header = packet.header;
-
-        if (packet.header.data_size > 0 && packet.data) {
-            packet_copy.data = new uint8_t[packet.header.data_size];
-            std::memcpy(packet_copy.data, packet.data, packet.header.data_size);
-        } else {
-            packet_copy.data = nullptr;
+    copy.reserve(_history_count);
+    for (uint32_t seqid = _history_oldest; copy.size() < _history_count; seqid++) {
+        const packet_t &packet = _history_sent[seqid % _history_sent.size()];
+        if (seqid != 0 && packet.header.seqid == seqid) {
+            copy.push_back(packet);
         }
-        copy.push_back(packet_copy);
     }
     return copy;
 }
 
+size_t PacketManager::_get_history_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _history_bytes;
+}
+
 std::vector<uint32_t> PacketManager::_get_missed_packets() const {
     std::lock_guard<std::mutex> lock(_mutex);
-    return _missed_packets;
+
+    std::vector<uint32_t> missed;
+    for (uint32_t i = 0; i < PACKET_ACK_BITS && _recv_seqid > i + 1; i++) {
+        if (!(_recv_bits & (1ULL << i))) {
+            missed.push_back(_recv_seqid - 1 - i);
+        }
+    }
+    return missed;
 }
 
 size_t PacketManager::_get_buffer_send_size() const {
@@ -452,47 +752,64 @@ bool PacketManager::isCompressionEnabled() const {
     return _compression_enabled;
 }
 
-std::vector<unsigned char> PacketManager::compress_data(const void* data, size_t size) {
+void PacketManager::setMtu(size_t mtu) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _mtu = mtu;
+}
+
+void PacketManager::setHistoryLimits(size_t max_packets, size_t max_bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (max_packets == 0) {
+        throw std::invalid_argument("History needs at least one slot");
+    }
+    if (max_packets != _history_sent.size()) {
+        _history_sent.assign(max_packets, packet_t{});
+        _history_resent.assign(max_packets, 0);
+        _history_sent_at.assign(max_packets, std::chrono::steady_clock::time_point{});
+        _history_count = 0;
+        _history_bytes = 0;
+    }
+    _history_max_bytes = max_bytes;
+    while (_history_count > 1 && _history_bytes > _history_max_bytes) {
+        _forgetHistory(_history_oldest++);
+    }
+}
+
+size_t PacketManager::compress_data(const void* data, size_t size, uint8_t *output) {
     if (!data || size == 0) {
         throw std::invalid_argument("Données invalides");
     }
 
-    // Calcul de la taille maximale après compression
+    // La sortie fait au moins compressBound(size) octets
     uLongf compressed_size = compressBound(size);
-    std::vector<unsigned char> compressed(compressed_size);
 
     // Compression
-    int result = compress(compressed.data(), &compressed_size,
+    int result = compress(output, &compressed_size,
                          static_cast<const Bytef*>(data), size);
 
     if (result != Z_OK) {
         throw std::runtime_error("Erreur de compression");
     }
-
-    // Redimensionne au taille réelle
-    compressed.resize(compressed_size);
-    return compressed;
+    return compressed_size;
 }
 
-// Décompresse les données
-// Retourne un vecteur contenant les données décompressées
-std::vector<unsigned char> PacketManager::decompress_data(const void* data, size_t compressed_size,
-                                           size_t original_size) {
+// Décompresse les données directement dans la sortie
+// Retourne la taille décompressée
+size_t PacketManager::decompress_data(const void* data, size_t compressed_size, uint8_t *output,
+                                      size_t original_size) {
     if (!data || compressed_size == 0) {
         throw std::invalid_argument("Données invalides");
     }
 
-    std::vector<unsigned char> decompressed(original_size);
     uLongf decompressed_size = original_size;
 
     // Décompression
-    int result = uncompress(decompressed.data(), &decompressed_size,
+    int result = uncompress(output, &decompressed_size,
                            static_cast<const Bytef*>(data), compressed_size);
 
     if (result != Z_OK) {
         throw std::runtime_error("Erreur de décompression");
     }
-
-    decompressed.resize(decompressed_size);
-    return decompressed;
-}
\ No newline at end of file
+    return decompressed_size;
+}
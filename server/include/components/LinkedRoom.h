@@ -24,6 +24,17 @@ namespace rtype::server::components {
         LinkedRoom(ECS::EntityID room_id = 0)
             : room_id(room_id) {
         }
+
+        /**
+         * @brief Key extractor indexing linked entities by room
+         *
+         * @example root.world.Index<LinkedRoom, LinkedRoom::ByRoom>().Find(room)
+         */
+        struct ByRoom {
+            ECS::EntityID operator()(const LinkedRoom &link) const {
+                return link.room_id;
+            }
+        };
     };
 }
 #endif //LINKEDROOM_H
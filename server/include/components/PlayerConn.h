@@ -76,6 +76,41 @@ namespace rtype::server::components {
         PlayerConn(std::string address = "", int port = 0, unsigned int room_code = 0)
             : address(address), port(port) , room_code(room_code) {
         };
+
+        /**
+         * @brief Builds the lookup key of a remote endpoint ("address:port")
+         * @param address Remote IP address (text form)
+         * @param port Remote port
+         * @return The key used by the ByAddress index
+         */
+        static std::string AddressKey(const std::string &address, int port) {
+            return address + ":" + std::to_string(port);
+        }
+
+        /**
+         * @brief Key extractor indexing connections by remote endpoint
+         *
+         * @example root.world.Index<PlayerConn, PlayerConn::ByAddress>().FindFirst(PlayerConn::AddressKey(ip, port))
+         */
+        struct ByAddress {
+            std::string operator()(const PlayerConn &conn) const {
+                return AddressKey(conn.address, conn.port);
+            }
+        };
+
+        /**
+         * @brief Key extractor indexing connections by room entity (room_code)
+         *
+         * Unlike LinkedRoom::ByRoom, only players are filed, so broadcasts do
+         * not walk the projectiles and enemies of the room.
+         *
+         * @example root.world.Index<PlayerConn, PlayerConn::ByRoom>().Find(room)
+         */
+        struct ByRoom {
+            ECS::EntityID operator()(const PlayerConn &conn) const {
+                return conn.room_code;
+            }
+        };
     };
 }
 
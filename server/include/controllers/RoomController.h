@@ -192,12 +192,11 @@ namespace rtype::server::controllers::room_controller {
      * @brief Find or create a player entity for a join request
      * @param packet The join room packet
      * @param playerName The player's name
-     * @param joinCode The join code from the packet
      * @param ipStr The player's IP address as string
      * @param port The player's port
      * @return The player entity ID, or 0 if creation failed
      */
-    ECS::EntityID findOrCreatePlayer(const packet_t& packet, const std::string& playerName, uint32_t joinCode, const std::string& ipStr, int port);
+    ECS::EntityID findOrCreatePlayer(const packet_t& packet, const std::string& playerName, const std::string& ipStr, int port);
     
     /**
      * @brief Find or create a room based on join code
@@ -14,6 +14,10 @@
 #define ROOMSERVICE_H
 #include "ECS/Types.h"
 
+namespace ECS {
+    class World;
+}
+
 namespace rtype::server::services::room_service {
     /**
      * @brief Opens a new room and returns its EntityID
@@ -63,6 +67,18 @@ namespace rtype::server::services::room_service {
      */
     void kickPlayer(ECS::EntityID player);
 
+    /**
+     * @brief Attaches a room-owned entity (enemy, projectile, assistant) to a room
+     *
+     * Adds the LinkedRoom component and makes the entity a child of the room,
+     * destroyed along with it. Players are linked with LinkedRoom only.
+     *
+     * @param world The world owning both entities
+     * @param entity The entity owned by the room
+     * @param room The EntityID of the room
+     */
+    void linkToRoom(ECS::World &world, ECS::EntityID entity, ECS::EntityID room);
+
     /**
      * @brief Closes a room and removes all its associated data
      * @param room The EntityID of the room to close
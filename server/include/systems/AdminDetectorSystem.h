@@ -12,6 +12,9 @@
 #include "components/RoomProperties.h"
 #include "ECS/System.h"
 #include "ECS/World.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 namespace rtype::server::components {
     class PlayerConn;
@@ -24,11 +27,48 @@ namespace rtype::server::components {
  * admin disconnects, automatically promotes the next available player in
  * the room to admin status and broadcasts the change to all room members.
  * 
+ * Rooms are only rescanned after a player connection appeared, went away or
+ * changed room, or a room was created; other runs cost a single flag check. The
+ * system runs at ROOM_CHECK_RATE rather than every tick.
+ * 
  * @note Priority: 10 (runs after most other systems)
  */
 class AdminDetectorSystem : public ECS::System {
 public:
+    /**
+     * @brief Admin checks per second, so a new admin is promoted within half a second
+     */
+    static constexpr float ROOM_CHECK_RATE = 2.0f;
+
     AdminDetectorSystem() : ECS::System("AdminDetectorSystem", 10) {
+        DeclareRead<rtype::server::components::PlayerConn>();
+        DeclareWrite<rtype::server::components::RoomProperties>();
+        SetUpdateRate(ROOM_CHECK_RATE);
+    }
+
+    /**
+     * @brief Subscribes to the events that can leave a room without admin
+     *
+     * @param world The ECS world containing all entities
+     */
+    void Initialize(ECS::World &world) override {
+        auto markDirty = [this](ECS::EntityID) { m_dirty.store(true, std::memory_order_relaxed); };
+        m_connCreated = world.OnConstruct<rtype::server::components::PlayerConn>().Connect(markDirty);
+        m_connDestroyed = world.OnDestroy<rtype::server::components::PlayerConn>().Connect(markDirty);
+        m_connUpdated = world.OnUpdate<rtype::server::components::PlayerConn>().Connect(markDirty);
+        m_roomCreated = world.OnConstruct<rtype::server::components::RoomProperties>().Connect(markDirty);
+    }
+
+    /**
+     * @brief Unsubscribes from the events connected in Initialize()
+     *
+     * @param world The ECS world containing all entities
+     */
+    void Cleanup(ECS::World &world) override {
+        world.OnConstruct<rtype::server::components::PlayerConn>().Disconnect(m_connCreated);
+        world.OnDestroy<rtype::server::components::PlayerConn>().Disconnect(m_connDestroyed);
+        world.OnUpdate<rtype::server::components::PlayerConn>().Disconnect(m_connUpdated);
+        world.OnConstruct<rtype::server::components::RoomProperties>().Disconnect(m_roomCreated);
     }
 
     /**
@@ -43,42 +83,38 @@ public:
      * @param deltaTime Time elapsed since last update (unused)
      */
     void Update(ECS::World &world, float deltaTime) override {
+        if (!m_dirty.exchange(false, std::memory_order_relaxed))
+            return;
+        auto &players_by_room = world.Index<rtype::server::components::PlayerConn,
+                                            rtype::server::components::PlayerConn::ByRoom>();
         for (auto &pair: *world.GetAllComponents<rtype::server::components::RoomProperties>()) {
             rtype::server::components::RoomProperties *room = pair.second.get();
             if (!room)
                 continue;
-            ECS::EntityID admin_id = room->ownerId;
+            // PlayerConn::room_code holds the room entity, not its join code
+            std::vector<ECS::EntityID> players = players_by_room.Find(pair.first);
 
             // Check if the admin player is still connected on that room
-            bool admin_still_connected = false;
-            for (auto &player_pair: *world.GetAllComponents<rtype::server::components::PlayerConn>()) {
-                ECS::EntityID playerId = player_pair.first;
-                rtype::server::components::PlayerConn *playerConn = player_pair.second.get();
-                if (!playerConn)
-                    continue;
-                if (playerConn->room_code == room->joinCode && playerId == admin_id) {
-                    admin_still_connected = true;
-                    break;
-                }
-            }
-            if (admin_still_connected)
+            if (players.empty() || std::find(players.begin(), players.end(), room->ownerId) != players.end())
                 continue;
             // Admin has disconnected, assign a new admin
-            for (auto &conn_pair: *world.GetAllComponents<rtype::server::components::PlayerConn>()) {
-                rtype::server::components::PlayerConn *playerConn = conn_pair.second.get();
-                if (!playerConn)
-                    continue;
-                if (playerConn->room_code != room->joinCode)
-                    continue;
-                // Assign new admin
-                room->ownerId = conn_pair.first;
-                RoomAdminUpdatePacket p{conn_pair.first};
-                // Broadcast to all players in the room about the new admin
-                room->broadcastPacket(&p, sizeof(p), ROOM_ADMIN_UPDATE, true);
-                break;
-            }
+            room->ownerId = players.front();
+            RoomAdminUpdatePacket p{players.front()};
+            // Broadcast to all players in the room about the new admin
+            room->broadcastPacket(&p, sizeof(p), ROOM_ADMIN_UPDATE, true);
         }
     }
+
+private:
+    /**
+     * @brief Set by the event listeners, cleared when the rooms are rescanned
+     */
+    std::atomic<bool> m_dirty{true};
+
+    ECS::ConnectionID m_connCreated = 0;
+    ECS::ConnectionID m_connDestroyed = 0;
+    ECS::ConnectionID m_connUpdated = 0;
+    ECS::ConnectionID m_roomCreated = 0;
 };
 
 
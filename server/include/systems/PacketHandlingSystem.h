@@ -42,11 +42,11 @@ public:
      * @param deltaTime Time elapsed since last update (unused)
      */
     void Update(ECS::World &world, float deltaTime) override {
-        for (ECS::EntityID entity: world.GetAllEntities()) {
-            auto *player = root.world.GetComponent<rtype::server::components::PlayerConn>(entity);
-            if (!player)
-                continue; // Skip entities that aren't players (e.g., rooms, enemies)
-            
+        // Only players own a PlayerConn, iterate that pool instead of every entity
+        auto *players = world.GetAllComponents<rtype::server::components::PlayerConn>();
+        for (auto &[entity, playerPtr] : *players) {
+            auto *player = playerPtr.get();
+
             int processedPackets = player->packet_handler.processPackets(player->packet_manager.fetchReceivedPackets());
             if (processedPackets > 0) {
                 player->last_packet_timestamp = rtype::tools::getCurrentTimestamp();
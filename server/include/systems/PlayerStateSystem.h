@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PlayerStateSystem - Broadcasts player positions and health at a fixed rate
+*/
+
+#ifndef SERVER_PLAYER_STATE_SYSTEM_H
+#define SERVER_PLAYER_STATE_SYSTEM_H
+
+#include "ECS/System.h"
+#include "ECS/World.h"
+
+namespace rtype::server::systems {
+
+/**
+ * @brief Sends the state of every player to the clients of its room
+ *
+ * Runs at BROADCAST_RATE through the scheduler's fixed-rate mode instead of
+ * every server tick, and only for rooms whose game has started.
+ *
+ * @note Priority: 6 (after ServerEnemySystem)
+ */
+class PlayerStateSystem : public ECS::System {
+public:
+    /**
+     * @brief Player state updates per second sent to each client
+     */
+    static constexpr float BROADCAST_RATE = 30.0f;
+
+    PlayerStateSystem() : ECS::System("PlayerStateSystem", 6) {
+        SetUpdateRate(BROADCAST_RATE);
+    }
+
+    /**
+     * @brief Sends position, rotation and health of each player to its room
+     *
+     * One pass over the players; the clients of each room come from the
+     * PlayerConn by-room index, looked up once per room.
+     *
+     * @param world The ECS world containing all entities
+     * @param deltaTime Fixed step, 1 / BROADCAST_RATE (unused)
+     */
+    void Update(ECS::World &world, float deltaTime) override;
+};
+
+} // namespace rtype::server::systems
+
+#endif // SERVER_PLAYER_STATE_SYSTEM_H
@@ -8,12 +8,55 @@
 #define ROOMCLEANSYSTEM_H
 #include "ECS/System.h"
 #include "server/include/components/LinkedRoom.h"
+#include "server/include/components/PlayerConn.h"
 #include "server/include/components/RoomProperties.h"
 #include "server/include/services/PlayerService.h"
+#include <atomic>
 
 class RoomCleanSystem : public ECS::System {
 public:
+    /**
+     * @brief Empty-room sweeps per second; an abandoned room lingers for at most half a second
+     */
+    static constexpr float ROOM_CHECK_RATE = 2.0f;
+
     RoomCleanSystem() : ECS::System("RoomCleanSystem", 10) {
+        DeclareRead<rtype::server::components::RoomProperties, rtype::server::components::LinkedRoom,
+                    rtype::server::components::PlayerConn>();
+        SetUpdateRate(ROOM_CHECK_RATE);
+    }
+
+    /**
+     * @brief Subscribes to the events that can leave a room empty
+     *
+     * A room can only become empty when one of its players disconnects or
+     * leaves it, or right after it is created. Other LinkedRoom events
+     * (projectiles, enemies) are filtered out.
+     *
+     * @param world The ECS world containing all entities
+     */
+    void Initialize(ECS::World &world) override {
+        auto markDirty = [this](ECS::EntityID) { m_dirty.store(true, std::memory_order_relaxed); };
+        auto markDirtyIfPlayer = [this, &world](ECS::EntityID entity) {
+            if (world.HasComponent<rtype::server::components::PlayerConn>(entity))
+                m_dirty.store(true, std::memory_order_relaxed);
+        };
+        m_connDestroyed = world.OnDestroy<rtype::server::components::PlayerConn>().Connect(markDirty);
+        m_linkDestroyed = world.OnDestroy<rtype::server::components::LinkedRoom>().Connect(markDirtyIfPlayer);
+        m_linkUpdated = world.OnUpdate<rtype::server::components::LinkedRoom>().Connect(markDirtyIfPlayer);
+        m_roomCreated = world.OnConstruct<rtype::server::components::RoomProperties>().Connect(markDirty);
+    }
+
+    /**
+     * @brief Unsubscribes from the events connected in Initialize()
+     *
+     * @param world The ECS world containing all entities
+     */
+    void Cleanup(ECS::World &world) override {
+        world.OnDestroy<rtype::server::components::PlayerConn>().Disconnect(m_connDestroyed);
+        world.OnDestroy<rtype::server::components::LinkedRoom>().Disconnect(m_linkDestroyed);
+        world.OnUpdate<rtype::server::components::LinkedRoom>().Disconnect(m_linkUpdated);
+        world.OnConstruct<rtype::server::components::RoomProperties>().Disconnect(m_roomCreated);
     }
 
     /**
@@ -21,51 +64,42 @@ public:
      *
      * For each room:
      * 1. Checks if there are any players in the room
-     * 2. If no players are found, destroys the room entity and any linked entities
+     * 2. If no players are found, destroys the room entity; the entities linked
+     *    through room_service::linkToRoom() are destroyed with it
      *  @param world The ECS world containing all entities
      *  @param deltaTime Time elapsed since last update (unused)
      */
     void Update(ECS::World &world, float deltaTime) override {
-        // Collect rooms with zero players first (avoid destroying while iterating containers)
-        std::vector<ECS::EntityID> rooms_to_destroy;
-
-        if (auto rooms = world.GetAllComponents<rtype::server::components::RoomProperties>()) {
-            for (auto &pair : *rooms) {
-                auto *room = pair.second.get();
-                if (!room)
-                    continue;
-                auto players = rtype::server::services::player_service::findPlayersByRoom(pair.first);
-                if (players.empty()) {
-                    rooms_to_destroy.push_back(pair.first);
-                }
-            }
-        }
-
-        if (rooms_to_destroy.empty())
+        if (!m_dirty.exchange(false, std::memory_order_relaxed))
             return;
 
-        // For each empty room, destroy its linked entities first, then the room entity itself
-        for (auto room_id : rooms_to_destroy) {
-            std::vector<ECS::EntityID> linked_to_destroy;
+        // Destruction is deferred to the end of the system, so containers can be walked directly
+        auto &commands = world.GetCommandBuffer();
+        auto *rooms = world.GetAllComponents<rtype::server::components::RoomProperties>();
 
-            if (auto linkedEntities = world.GetAllComponents<rtype::server::components::LinkedRoom>()) {
-                for (auto &linkedPair : *linkedEntities) {
-                    auto *lr = linkedPair.second.get();
-                    if (lr && lr->room_id == room_id) {
-                        linked_to_destroy.push_back(linkedPair.first);
-                    }
-                }
-            }
+        for (auto &pair : *rooms) {
+            auto *room = pair.second.get();
+            if (!room)
+                continue;
+            auto players = rtype::server::services::player_service::findPlayersByRoom(pair.first);
+            if (!players.empty())
+                continue;
 
-            // Destroy linked entities
-            for (auto eid : linked_to_destroy) {
-                world.DestroyEntity(eid);
-            }
-
-            // Finally destroy the room entity
-            world.DestroyEntity(room_id);
+            // Empty room: entities linked to it are its children and go with it
+            commands.DestroyEntity(pair.first);
         }
     }
+
+private:
+    /**
+     * @brief Set by the event listeners, cleared when the rooms are rescanned
+     */
+    std::atomic<bool> m_dirty{true};
+
+    ECS::ConnectionID m_connDestroyed = 0;
+    ECS::ConnectionID m_linkDestroyed = 0;
+    ECS::ConnectionID m_linkUpdated = 0;
+    ECS::ConnectionID m_roomCreated = 0;
 };
 
 
@@ -63,17 +63,17 @@ private:
      * - Marks dead entities for destruction
      *
      * @param world The ECS world
-     * @param toDestroy Vector to accumulate entities to destroy
+     * @param commands Command buffer recording the entities to destroy
      */
-    void checkProjectileVsEnemyCollisions(ECS::World& world, std::vector<ECS::EntityID>& toDestroy);
+    void checkProjectileVsEnemyCollisions(ECS::World& world, ECS::CommandBuffer& commands);
 
     /**
      * @brief Checks collisions between enemy projectiles and players
      *
      * @param world The ECS world
-     * @param toDestroy Vector to accumulate entities to destroy
+     * @param commands Command buffer recording the entities to destroy
      */
-    void checkEnemyProjectilesVsPlayerCollisions(ECS::World& world, std::vector<ECS::EntityID>& toDestroy);
+    void checkEnemyProjectilesVsPlayerCollisions(ECS::World& world, ECS::CommandBuffer& commands);
 
     /**
      * @brief Checks collisions between players and enemies (direct contact)
@@ -2,7 +2,7 @@
 ** EPITECH PROJECT, 2025
 ** rtype
 ** File description:
-** ServerEnemySystem - Spawns enemies and bosses, broadcasts player states
+** ServerEnemySystem - Spawns enemies and bosses
 */
 #ifndef SERVER_ENEMY_SYSTEM_H
 #define SERVER_ENEMY_SYSTEM_H
@@ -11,13 +11,14 @@
 #include "rtype.h"
 
 /**
- * @brief System responsible for enemy spawning and player state broadcasting
+ * @brief System responsible for enemy spawning
  * 
  * This system handles three main responsibilities:
  * 1. Spawns regular enemies every 2 seconds for active game rooms
  * 2. Spawns bosses every 3 minutes (only if no boss exists)
- * 3. Broadcasts player states to all clients at 20Hz for active games
- * 4. Cleans up dead entities and broadcasts destruction
+ * 3. Cleans up dead entities and broadcasts destruction
+ * 
+ * Player states are broadcast by PlayerStateSystem, at its own fixed rate.
  * 
  * All enemy spawns are server-authoritative and broadcast via SPAWN_ENEMY
  * packets to ensure all clients see the same enemies at the same time.
@@ -49,9 +50,9 @@ struct LevelDefinition {
 
 /**
  * @class ServerEnemySystem
- * @brief System responsible for enemy spawning and player state broadcasting
+ * @brief System responsible for enemy spawning
  *
- * Handles enemy and boss spawning, player state broadcasting, and entity cleanup.
+ * Handles enemy and boss spawning, and entity cleanup.
  */
 class ServerEnemySystem : public ECS::System {
 public:
@@ -65,7 +66,7 @@ public:
      * @brief Main update loop for the system
      * @param world Reference to the ECS world
      * @param deltaTime Time elapsed since last update
-     * Spawns enemies/bosses, broadcasts player states, and cleans up entities.
+     * Spawns enemies/bosses and cleans up entities.
      */
     void Update(ECS::World &world, float deltaTime) override;
 
@@ -114,9 +115,6 @@ private:
     std::vector<LevelDefinition> _levelDefinitions; ///< Enemy definitions for each level
     std::map<rtype::common::components::EnemyType, EnemySpawnConfig> _enemyConfigs; ///< Enemy spawn configs
 
-    float _stateTick; ///< Timer for player state broadcast
-    static constexpr float STATE_TICK_INTERVAL = 0.03f; // 30ms for better responsiveness
-
     // Obstacle spawn timers (randomized per interval)
     float _meteoriteTimer{0.0f};
     float _meteoriteNext{3.0f};
@@ -129,7 +127,6 @@ private:
     void updateBossSpawning(ECS::World& world, float deltaTime);
     void updateObstacleSpawning(ECS::World& world, float deltaTime);
     void spawnDebrisRow(ECS::World& world, ECS::EntityID room, int count);
-    void updatePlayerStateBroadcast(ECS::World& world, float deltaTime);
     void cleanupDeadEntities(ECS::World& world);
     void checkBossDeathAndAdvanceLevel(ECS::World& world);
 };
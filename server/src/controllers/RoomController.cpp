@@ -29,6 +29,7 @@
 #include <common/components/Shield.h>
 #include <common/components/ForgeAugment.h>
 #include <common/components/Bounce.h>
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 #include <cmath>
@@ -53,6 +54,41 @@
 using namespace rtype::server::controllers;
 using namespace rtype::server::services;
 
+// ============================================================================
+// HELPER FUNCTIONS - Projectile prefabs
+// ============================================================================
+
+// Components shared by every player projectile; per-shot values are written by initPlayerProjectile
+static const ECS::Prefab &playerProjectilePrefab() {
+    static const ECS::Prefab prefab = ECS::Prefab("Player projectile")
+        .With<rtype::common::components::Position>()
+        .With<rtype::common::components::Velocity>()
+        .With<rtype::common::components::Team>(rtype::common::components::TeamType::Player)
+        .With<rtype::common::components::Projectile>(1, false, true);
+    return prefab;
+}
+
+// Homing darts (AzurePhantom charged shot)
+static const ECS::Prefab &homingDartPrefab() {
+    static const ECS::Prefab prefab = ECS::Prefab(playerProjectilePrefab())
+        .With<rtype::common::components::Homing>(0, 800.0f, 180.0f, 450.0f);
+    return prefab;
+}
+
+static void initPlayerProjectile(ECS::EntityID projectile, ECS::EntityID room, ECS::EntityID owner,
+                                 float x, float y, float vx, float vy, float speed,
+                                 uint16_t damage, bool piercing) {
+    *root.world.GetComponent<rtype::common::components::Position>(projectile) =
+        rtype::common::components::Position(x, y, 0.0f);
+    *root.world.GetComponent<rtype::common::components::Velocity>(projectile) =
+        rtype::common::components::Velocity(vx, vy, speed);
+    auto *projComp = root.world.GetComponent<rtype::common::components::Projectile>(projectile);
+    *projComp = rtype::common::components::Projectile(damage, piercing, true, speed);
+    projComp->ownerId = owner;
+
+    room_service::linkToRoom(root.world, projectile, room);
+}
+
 // ============================================================================
 // HELPER FUNCTIONS - Game Start Flow
 // ============================================================================
@@ -101,15 +137,15 @@ static void spawnForgeExtras(ECS::EntityID room, ECS::EntityID owner, float x, f
             const float startDeg = -angleSpread / 2.f;
             const float baseSpeed = 600.f;
             const int dmg = 1; // 0.5 -> rounded to 1
-            for (int i = 0; i < count; ++i) {
+            auto pellets = root.world.Instantiate(playerProjectilePrefab(), count, [&](ECS::EntityID p, std::size_t i) {
                 float deg = startDeg + i * angleStep;
                 float rad = deg * 3.1415926f / 180.f;
                 float vx = baseSpeed * std::cos(rad);
                 float vy = baseSpeed * std::sin(rad);
-                auto p = room_controller::createSingleProjectile(room, owner, x + 32.f, y, vx, vy, baseSpeed, dmg, false, false);
-                if (auto* pr = root.world.GetComponent<rtype::common::components::Projectile>(p)) {
-                    pr->maxDistance = baseSpeed * 0.5f; // ~0.5s travel
-                }
+                initPlayerProjectile(p, room, owner, x + 32.f, y, vx, vy, baseSpeed, dmg, false);
+                root.world.GetComponent<rtype::common::components::Projectile>(p)->maxDistance = baseSpeed * 0.5f; // ~0.5s travel
+            });
+            for (auto p : pellets) {
                 room_controller::broadcastProjectileSpawn(p, owner, room, false);
             }
             break;
@@ -119,11 +155,11 @@ static void spawnForgeExtras(ECS::EntityID room, ECS::EntityID owner, float x, f
             const float speed = 560.f;
             const int dmg = 1;
             const float offsets[3] = {-8.f, 0.f, 8.f};
-            for (float offY : offsets) {
-                auto p = room_controller::createSingleProjectile(room, owner, x + 32.f, y + offY, speed, dmg, false, false);
-                if (auto* pr = root.world.GetComponent<rtype::common::components::Projectile>(p)) {
-                    pr->maxDistance = 380.f; // moderate range
-                }
+            auto beams = root.world.Instantiate(playerProjectilePrefab(), 3, [&](ECS::EntityID p, std::size_t i) {
+                initPlayerProjectile(p, room, owner, x + 32.f, y + offsets[i], speed, 0.0f, speed, dmg, false);
+                root.world.GetComponent<rtype::common::components::Projectile>(p)->maxDistance = 380.f; // moderate range
+            });
+            for (auto p : beams) {
                 room_controller::broadcastProjectileSpawn(p, owner, room, false);
             }
             break;
@@ -227,7 +263,7 @@ void room_controller::broadcastPlayerRoster(ECS::EntityID room) {
 // ============================================================================
 
 ECS::EntityID room_controller::findOrCreatePlayer(const packet_t &packet, const std::string &playerName,
-                                                  uint32_t joinCode, const std::string &ipStr, int port) {
+                                                  const std::string &ipStr, int port) {
     // Look up player by network address
     ECS::EntityID player = player_service::findPlayerByNetwork(packet.header.client_addr, packet.header.client_port);
 
@@ -243,15 +279,19 @@ ECS::EntityID room_controller::findOrCreatePlayer(const packet_t &packet, const
     }
 
     // Player doesn't exist, create new one with selected vessel type (from JoinRoomPacket)
-    const JoinRoomPacket *jp = reinterpret_cast<const JoinRoomPacket *>(packet.data);
+    const JoinRoomPacket *jp = reinterpret_cast<const JoinRoomPacket *>(packet.data());
     auto vesselType = static_cast<rtype::common::components::VesselType>(jp ? jp->vesselType : 0);
-    player = player_service::createNewPlayer(playerName, joinCode, ipStr, port, vesselType);
+    // No room yet: room_code holds the room entity, set once the join code is resolved
+    player = player_service::createNewPlayer(playerName, 0, ipStr, port, vesselType);
 
     // Re-check to ensure player was created successfully
     player = player_service::findPlayerByNetwork(packet.header.client_addr, packet.header.client_port);
     if (!player) {
         std::cerr << "ERROR: Failed to create or find player entity for network address " << ipStr << ":" << port <<
                 std::endl;
+    } else if (auto *conn = root.world.GetComponent<components::PlayerConn>(player)) {
+        // The join request went through the global packet manager, the connection continues after it
+        conn->packet_manager.resumeAfter(packet.header.seqid);
     }
 
     return player;
@@ -289,7 +329,7 @@ void room_controller::sendJoinAccepted(ECS::EntityID player, ECS::EntityID room)
     }
 
     // Store room entity ID in player's connection (note: field name 'room_code' is misleading, it stores entity ID)
-    playernet->room_code = room;
+    root.world.ModifyComponent<components::PlayerConn>(player)->room_code = room;
 
     // Get player's vessel type
     uint8_t vesselType = 0; // Default: CrimsonStriker
@@ -391,20 +431,18 @@ ECS::EntityID room_controller::createServerProjectile(ECS::EntityID room, ECS::E
                 const float baseSpeed = 480.0f;
                 const int dmg = 1;
                 const float step = 360.0f / count;
-                ECS::EntityID first = 0;
-                for (int i = 0; i < count; ++i) {
+                auto pulse = root.world.Instantiate(playerProjectilePrefab(), count, [&](ECS::EntityID proj, std::size_t i) {
                     float deg = i * step;
                     float rad = deg * 3.1415926f / 180.f;
                     float vx = baseSpeed * std::cos(rad);
                     float vy = baseSpeed * std::sin(rad);
-                    auto proj = createSingleProjectile(room, owner, x, y, vx, vy, baseSpeed, dmg, false, true);
-                    if (auto* pr = root.world.GetComponent<rtype::common::components::Projectile>(proj)) {
-                        pr->maxDistance = 260.0f; // short-lived pulse
-                    }
+                    initPlayerProjectile(proj, room, owner, x, y, vx, vy, baseSpeed, dmg, false);
+                    root.world.GetComponent<rtype::common::components::Projectile>(proj)->maxDistance = 260.0f; // short-lived pulse
+                });
+                for (auto proj : pulse) {
                     broadcastProjectileSpawn(proj, owner, room, true);
-                    if (i == 0) first = proj;
                 }
-                return first; // Done
+                return pulse.front(); // Done
             }
 
             // Normal single projectile (CrimsonStriker normal, EmeraldTitan)
@@ -437,29 +475,19 @@ ECS::EntityID room_controller::createServerProjectile(ECS::EntityID room, ECS::E
             float angleStep = 15.0f; // 15 degrees between each dart
             float startAngle = -(angleStep * (count - 1)) / 2.0f;
             
-            for (int i = 0; i < count; ++i) {
+            auto darts = root.world.Instantiate(homingDartPrefab(), std::max(count, 0), [&](ECS::EntityID proj, std::size_t i) {
                 float angle = startAngle + (i * angleStep);
                 float radians = angle * 3.14159f / 180.0f;
                 float vx = baseSpeed * std::cos(radians);
                 float vy = baseSpeed * std::sin(radians);
-                
-                auto proj = root.world.CreateEntity();
-                root.world.AddComponent<rtype::common::components::Position>(proj, projectileX, y, 0.0f);
-                root.world.AddComponent<rtype::common::components::Velocity>(proj, vx, vy, baseSpeed);
-                root.world.AddComponent<rtype::common::components::Team>(proj, rtype::common::components::TeamType::Player);
-                root.world.AddComponent<rtype::common::components::Projectile>(proj, baseDamage, piercing, true, baseSpeed);
-                auto *projComp = root.world.GetComponent<rtype::common::components::Projectile>(proj);
-                if (projComp) projComp->ownerId = owner;
-                root.world.AddComponent<rtype::server::components::LinkedRoom>(proj, room);
-                
-                // Add homing component
-                root.world.AddComponent<rtype::common::components::Homing>(proj, 0, 800.0f, 180.0f, 450.0f);
-                
-                // Broadcast each projectile
+                initPlayerProjectile(proj, room, owner, projectileX, y, vx, vy, baseSpeed, baseDamage, piercing);
+            });
+            
+            // Broadcast each projectile
+            for (auto proj : darts) {
                 broadcastProjectileSpawn(proj, owner, room, isCharged);
-                
-                if (i == 0) firstProjectile = proj;
             }
+            if (!darts.empty()) firstProjectile = darts.front();
             break;
         }
         
@@ -470,16 +498,17 @@ ECS::EntityID room_controller::createServerProjectile(ECS::EntityID room, ECS::E
             float angleStep = angleSpread / (count - 1);
             float startAngle = -angleSpread / 2.0f;
             
-            for (int i = 0; i < count; ++i) {
+            auto pellets = root.world.Instantiate(playerProjectilePrefab(), std::max(count, 0), [&](ECS::EntityID proj, std::size_t i) {
                 float angle = startAngle + (i * angleStep);
                 float radians = angle * 3.14159f / 180.0f;
                 float vx = baseSpeed * std::cos(radians);
                 float vy = baseSpeed * std::sin(radians);
-                
-                auto proj = createSingleProjectile(room, owner, projectileX, y, vx, vy, baseSpeed, baseDamage, piercing, isCharged);
+                initPlayerProjectile(proj, room, owner, projectileX, y, vx, vy, baseSpeed, baseDamage, piercing);
+            });
+            for (auto proj : pellets) {
                 broadcastProjectileSpawn(proj, owner, room, isCharged);
-                if (i == 0) firstProjectile = proj;
             }
+            if (!pellets.empty()) firstProjectile = pellets.front();
             break;
         }
         
@@ -506,19 +535,9 @@ ECS::EntityID room_controller::createSingleProjectile(ECS::EntityID room, ECS::E
 ECS::EntityID room_controller::createSingleProjectile(ECS::EntityID room, ECS::EntityID owner, 
                                                        float x, float y, float vx, float vy, float speed,
                                                        uint16_t damage, bool piercing, bool isCharged) {
-    auto projectile = root.world.CreateEntity();
-    
-    root.world.AddComponent<rtype::common::components::Position>(projectile, x, y, 0.0f);
-    root.world.AddComponent<rtype::common::components::Velocity>(projectile, vx, vy, speed);
-    root.world.AddComponent<rtype::common::components::Team>(projectile, rtype::common::components::TeamType::Player);
-    root.world.AddComponent<rtype::common::components::Projectile>(projectile, damage, piercing, true, speed);
-    
-    auto *projComp = root.world.GetComponent<rtype::common::components::Projectile>(projectile);
-    if (projComp) projComp->ownerId = owner;
-    
-    root.world.AddComponent<rtype::server::components::LinkedRoom>(projectile, room);
-    
-    return projectile;
+    return root.world.Instantiate(playerProjectilePrefab(), 1, [&](ECS::EntityID projectile, std::size_t) {
+        initPlayerProjectile(projectile, room, owner, x, y, vx, vy, speed, damage, piercing);
+    }).front();
 }
 
 ECS::EntityID room_controller::createEnemyProjectile(ECS::EntityID room, float x, float y, float vx, float vy, ECS::World& world) {
@@ -538,7 +557,7 @@ ECS::EntityID room_controller::createEnemyProjectile(ECS::EntityID room, float x
     world.AddComponent<rtype::common::components::Projectile>(projectile, 1, false, false);
 
     // Link to room
-    world.AddComponent<rtype::server::components::LinkedRoom>(projectile, room);
+    room_service::linkToRoom(world, projectile, room);
 
     return projectile;
 }
@@ -623,7 +642,7 @@ void room_controller::handleGameStartRequest(const packet_t &packet) {
             // That would cause networking code to attempt to send packets to an invalid address
             // Instead we only attach a LinkedRoom so broadcasting systems can find it as a source
             root.world.AddComponent<rtype::server::components::Assistant>(assistant, 0.0f);
-            root.world.AddComponent<rtype::server::components::LinkedRoom>(assistant, room);
+            room_service::linkToRoom(root.world, assistant, room);
 
             std::cout << "SERVER: Spawned AI assistant " << assistant << " in room " << room << std::endl;
 
@@ -634,7 +653,7 @@ void room_controller::handleGameStartRequest(const packet_t &packet) {
 }
 
 void room_controller::handlePlayerInput(const packet_t &packet) {
-    PlayerInputPacket *p = (PlayerInputPacket *) packet.data;
+    PlayerInputPacket *p = (PlayerInputPacket *) packet.data();
 
     // Find the player entity by network address
     ECS::EntityID player = player_service::findPlayerByNetwork(packet.header.client_addr, packet.header.client_port);
@@ -671,7 +690,7 @@ void room_controller::handlePlayerInput(const packet_t &packet) {
 
 void room_controller::handlePlayerShoot(const packet_t &packet) {
     // Parse packet to get charged shot flag and player position
-    PlayerShootPacket *p = (PlayerShootPacket *) packet.data;
+    PlayerShootPacket *p = (PlayerShootPacket *) packet.data();
 
     // Extract endianness
     from_network_endian(p->playerX);
@@ -704,7 +723,7 @@ void room_controller::handlePlayerShoot(const packet_t &packet) {
 }
 
 void room_controller::handleLobbySettingsUpdate(const packet_t &packet) {
-    LobbySettingsUpdatePacket *p = (LobbySettingsUpdatePacket *) packet.data;
+    LobbySettingsUpdatePacket *p = (LobbySettingsUpdatePacket *) packet.data();
 
     // Identify the player and room
     ECS::EntityID player = player_service::findPlayerByNetwork(packet.header.client_addr, packet.header.client_port);
@@ -748,14 +767,14 @@ void room_controller::handleLobbySettingsUpdate(const packet_t &packet) {
 }
 
 void room_controller::handleJoinRoomPacket(const packet_t &packet) {
-    JoinRoomPacket *p = (JoinRoomPacket *) packet.data;
+    JoinRoomPacket *p = (JoinRoomPacket *) packet.data();
 
     // Extract endianes
     from_network_endian(p->joinCode);
     std::string ip_str = rtype::tools::ipToString(const_cast<uint8_t *>(packet.header.client_addr));
 
     // Find or create player entity, checking for active game conflict
-    ECS::EntityID player = findOrCreatePlayer(packet, std::string(p->name), p->joinCode, ip_str,
+    ECS::EntityID player = findOrCreatePlayer(packet, std::string(p->name), ip_str,
                                               packet.header.client_port);
     if (!player) return; // Player in active game or creation failed
 
@@ -788,7 +807,7 @@ void room_controller::handleJoinRoomPacket(const packet_t &packet) {
 void room_controller::handlePlayerReady(const packet_t &packet) {
     std::cout << "=== handlePlayerReady called (PUBLIC ROOMS ONLY) ===" << std::endl;
 
-    PlayerReadyPacket *p = (PlayerReadyPacket *) packet.data;
+    PlayerReadyPacket *p = (PlayerReadyPacket *) packet.data();
 
     // Extract endianes
     // (none needed, just a bool)
@@ -8,10 +8,12 @@
 #include "systems/EnemyAISystem.h"
 #include "systems/RoomCleanSystem.h"
 #include "systems/AssistantSystem.h"
+#include "systems/PlayerStateSystem.h"
 #include <common/components/Position.h>
 #include <common/components/Velocity.h>
 #include <common/components/Projectile.h>
 #include <common/components/Player.h>
+#include <common/components/Team.h>
 #include <common/systems/MovementSystem.h>
 #include <common/systems/FortressShieldSystem.h>
 #include "components/LobbyState.h"
@@ -19,6 +21,7 @@
 #include "components/LinkedRoom.h"
 #include "senders.h"
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <cmath>
 #include "systems/AdminDetectorSystem.h"
@@ -62,28 +65,23 @@ void rtype::server::Rtype::loop(float deltaTime) {
     rtype::common::systems::MovementSystem::update(world, deltaTime);
 
     // Server-specific post-movement processing
-    auto* positions = world.GetAllComponents<rtype::common::components::Position>();
-    if (positions) {
-        for (auto& [entity, posPtr] : *positions) {
-            // Note: projectile distanceTraveled is now updated in MovementSystem (common)
-
-            // Clamp player positions to game bounds (server-authoritative)
-            auto* player = world.GetComponent<rtype::common::components::Player>(entity);
-            if (player && posPtr) {
-                clampPlayerPosition(posPtr.get());
-            }
+    // Clamp player positions to game bounds (server-authoritative)
+    // Note: projectile distanceTraveled is now updated in MovementSystem (common)
+    for (auto [entity, pos, player] : world.View<rtype::common::components::Position, rtype::common::components::Player>()) {
+        clampPlayerPosition(&pos);
+    }
 
-            // Update invulnerability timers for all entities with Health
-            auto* health = world.GetComponent<rtype::common::components::Health>(entity);
-            if (health && health->invulnerable) {
-                health->invulnerabilityTimer -= deltaTime;
-                if (health->invulnerabilityTimer <= 0.0f) {
-                    health->invulnerable = false;
-                    health->invulnerabilityTimer = 0.0f;
+    // Update invulnerability timers for all positioned entities with Health
+    world.View<rtype::common::components::Position, rtype::common::components::Health>().Each(
+        [deltaTime](rtype::common::components::Position &, rtype::common::components::Health &health) {
+            if (health.invulnerable) {
+                health.invulnerabilityTimer -= deltaTime;
+                if (health.invulnerabilityTimer <= 0.0f) {
+                    health.invulnerable = false;
+                    health.invulnerabilityTimer = 0.0f;
                 }
             }
-        }
-    }
+        });
 
     world.UpdateSystems(deltaTime);
     
@@ -95,6 +93,13 @@ void rtype::server::Rtype::loop(float deltaTime) {
 int main() {
     rtype::server::Rtype &r = root;
     r.udp_server_fd = rtype::server::network::setupUDPServer(4242);
+    // Packets from unknown addresses come from many clients, each with its own sequence IDs
+    r.packetManager.setSequencingEnabled(false);
+    // Build the lookup indexes and partitions before the network thread starts querying them
+    r.world.Index<rtype::server::components::PlayerConn, rtype::server::components::PlayerConn::ByAddress>();
+    r.world.Index<rtype::server::components::PlayerConn, rtype::server::components::PlayerConn::ByRoom>();
+    r.world.Index<rtype::server::components::LinkedRoom, rtype::server::components::LinkedRoom::ByRoom>();
+    r.world.Partition<rtype::common::components::Team, rtype::common::components::Team::ByTeam>();
     // Run the network loop in a separate thread
     std::thread networkThread(net_loop);
     networkThread.detach();
@@ -110,6 +115,7 @@ int main() {
     // Register systems
     root.world.RegisterSystem<PacketHandlingSystem>();
     root.world.RegisterSystem<ServerEnemySystem>();
+    root.world.RegisterSystem<rtype::server::systems::PlayerStateSystem>();
     root.world.RegisterSystem<rtype::server::systems::ServerCollisionSystem>();
     root.world.RegisterSystem<rtype::server::systems::AssistantSystem>();
     root.world.RegisterSystem<RoomCleanSystem>();
@@ -147,6 +153,13 @@ int main() {
 
     root.world.RegisterSystem<AdminDetectorSystem>();
 
+    // RTYPE_PROFILE=1 prints per-system tick timings every 10 seconds
+    if (std::getenv("RTYPE_PROFILE")) {
+        root.world.SetProfileDump(600, [](const ECS::ProfileReport &report) {
+            std::cout << ECS::FormatProfileReport(report) << std::flush;
+        });
+    }
+
     auto lastTime = std::chrono::high_resolution_clock::now();
     constexpr float TARGET_DELTA = 1.0f / 60.0f;
 
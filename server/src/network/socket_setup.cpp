@@ -101,13 +101,13 @@ int rtype::server::network::setupUDPServer(int port) {
 }
 
 void rtype::server::network::loop_send(int udp_server_fd) {
-    std::vector<std::unique_ptr<packet_t> > packets = root.packetManager.fetchPacketsToSend();
+    std::vector<std::unique_ptr<packet_t> > packets = root.packetManager.fetchDatagramsToSend();
     auto *players = root.world.GetAllComponents<rtype::server::components::PlayerConn>();
 
     for (const auto &pair: *players) {
         auto *p = root.world.GetComponent<components::PlayerConn>(pair.first);
         if (p) {
-            std::vector<std::unique_ptr<packet_t> > player_packets = p->packet_manager.fetchPacketsToSend();
+            std::vector<std::unique_ptr<packet_t> > player_packets = p->packet_manager.fetchDatagramsToSend();
             // Force the ip address to each packet
             for (auto &packet: player_packets) {
                 std::string addr = p->address;
@@ -128,7 +128,8 @@ void rtype::server::network::loop_send(int udp_server_fd) {
     }
 
     for (auto &packet: packets) {
-        std::vector<uint8_t> serialized = PacketManager::serializePacket(*packet);
+        size_t serialized_size = 0;
+        const uint8_t *serialized = PacketManager::wireBytes(*packet, &serialized_size);
 
         // Extract client address and port from packet header
         struct sockaddr_in clientaddr;
@@ -141,7 +142,7 @@ void rtype::server::network::loop_send(int udp_server_fd) {
         clientaddr.sin_port = htons(packet->header.client_port);
 
         // Send the serialized packet to the client
-        int bytes_sent = sendto(udp_server_fd, reinterpret_cast<const char*>(serialized.data()), serialized.size(), 0,
+        int bytes_sent = sendto(udp_server_fd, reinterpret_cast<const char*>(serialized), serialized_size, 0,
                                 (struct sockaddr *) &clientaddr, sizeof(clientaddr));
 
         if (bytes_sent < 0) {
@@ -156,25 +157,26 @@ void rtype::server::network::loop_send(int udp_server_fd) {
 }
 
 void rtype::server::network::loop_recv(int udp_server_fd) {
-    uint8_t buffer[MAX_PACKET_SIZE];
+    // Receive straight into a pooled buffer, which becomes the packet storage
+    PacketBuffer buffer = PacketBuffer::allocate(MAX_PACKET_SIZE);
     struct sockaddr_in cliaddr{};
     socklen_t len = sizeof(cliaddr);
-    packet_t packet;
 #ifdef _WIN32
-    int n = recvfrom(udp_server_fd, (char*)buffer, sizeof(buffer), MSG_DONTWAIT, (struct sockaddr *) &cliaddr, &len);
+    int n = recvfrom(udp_server_fd, (char*)buffer.bytes(), buffer.size(), MSG_DONTWAIT, (struct sockaddr *) &cliaddr, &len);
 #else
-    int n = recvfrom(udp_server_fd, buffer, sizeof(buffer), MSG_DONTWAIT, (struct sockaddr *) &cliaddr, &len);
+    int n = recvfrom(udp_server_fd, buffer.bytes(), buffer.size(), MSG_DONTWAIT, (struct sockaddr *) &cliaddr, &len);
 #endif
 
-    if (n > 0) {
+    if (n >= (int) PACKET_BUFFER_HEADROOM) {
+        buffer.resize(n - PACKET_BUFFER_HEADROOM);
         // Redirect to the appropriate player or to the global packet manager
         auto pid = rtype::server::services::player_service::findPlayerByNetwork(cliaddr);
         if (pid) {
             auto p = root.world.GetComponent<components::PlayerConn>(pid);
-            p->packet_manager.handlePacketBytes(buffer, n, cliaddr);
+            p->packet_manager.handlePacketBuffer(std::move(buffer), cliaddr);
         } else {
             std::cout << "[INFO] Packet not associated with any player, handling globally" << std::endl;
-            root.packetManager.handlePacketBytes(buffer, n, cliaddr);
+            root.packetManager.handlePacketBuffer(std::move(buffer), cliaddr);
         }
     } else if (n < 0) {
         // Check if it's just no data available (non-blocking behavior)
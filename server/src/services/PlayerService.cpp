@@ -69,15 +69,9 @@ ECS::EntityID player_service::createNewPlayer(std::string name, int room_code, s
 }
 
 ECS::EntityID player_service::findPlayerByNetwork(const std::string &ip, int port) {
-    auto players = root.world.GetAllComponents<rtype::server::components::PlayerConn>();
+    using rtype::server::components::PlayerConn;
 
-    for (const auto &pair: *players) {
-        auto *addr = root.world.GetComponent<rtype::server::components::PlayerConn>(pair.first);
-        if (addr && addr->address == ip && addr->port == port) {
-            return pair.first;
-        }
-    }
-    return 0;
+    return root.world.Index<PlayerConn, PlayerConn::ByAddress>().FindFirst(PlayerConn::AddressKey(ip, port));
 }
 
 ECS::EntityID player_service::findPlayerByNetwork(const uint8_t *uint8_t, uint16_t port) {
@@ -104,14 +98,7 @@ std::vector<ECS::EntityID> player_service::findPlayersByRoomCode(int room_code)
 }
 
 std::vector<ECS::EntityID> player_service::findPlayersByRoom(ECS::EntityID room) {
-    std::vector<ECS::EntityID> players_in_room;
-    auto players = root.world.GetAllComponents<rtype::server::components::PlayerConn>();
+    using rtype::server::components::PlayerConn;
 
-    for (const auto &pair: *players) {
-        auto *linkedRoom = root.world.GetComponent<rtype::server::components::LinkedRoom>(pair.first);
-        if (linkedRoom && linkedRoom->room_id == room) {
-            players_in_room.push_back(pair.first);
-        }
-    }
-    return players_in_room;
+    return root.world.Index<PlayerConn, PlayerConn::ByRoom>().Find(room);
 }
@@ -26,7 +26,7 @@ ECS::EntityID room_service::openNewRoom(bool is_public, ECS::EntityID player) {
     root.world.AddComponent<components::RoomProperties>(room, join_code, is_public, player);
 
     // Set the player in the room
-    if (auto *playerComp = root.world.GetComponent<server::components::PlayerConn>(player)) {
+    if (auto *playerComp = root.world.ModifyComponent<server::components::PlayerConn>(player)) {
         playerComp->room_code = room;
     }
     return room;
@@ -91,6 +91,11 @@ void room_service::kickPlayer(ECS::EntityID player) {
     root.world.DestroyEntity(player);
 }
 
+void room_service::linkToRoom(ECS::World &world, ECS::EntityID entity, ECS::EntityID room) {
+    world.AddComponent<server::components::LinkedRoom>(entity, room);
+    world.SetParent(entity, room, true);
+}
+
 void room_service::closeRoom(ECS::EntityID room) {
     auto *rp = root.world.GetComponent<components::RoomProperties>(room);
 
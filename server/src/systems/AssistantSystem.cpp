@@ -18,6 +18,9 @@ AssistantSystem::AssistantSystem()
     : ECS::System("AssistantSystem", 4)
 {
     // constructor initializes system name and priority for the ECS
+    DeclareRead<rtype::common::components::EnemyTypeComponent, rtype::common::components::Position,
+                rtype::common::components::Health, rtype::server::components::LinkedRoom>();
+    DeclareWrite<rtype::server::components::Assistant, rtype::common::components::Velocity>();
 }
 
 void AssistantSystem::Update(ECS::World &world, float deltaTime) {
@@ -101,11 +104,13 @@ void AssistantSystem::Update(ECS::World &world, float deltaTime) {
 
         // Shooting: if nearest enemy in range and cooldown ready, shoot basic projectile
         if (nearest != 0 && assistantComp->shootCooldown <= 0.0f) {
-            // Create a server projectile and broadcast
-            ECS::EntityID proj = rtype::server::controllers::room_controller::createServerProjectile(linked->room_id, aid, pos->x, pos->y, false);
-            rtype::server::controllers::room_controller::broadcastProjectileSpawn(proj, aid, linked->room_id, false);
+            // Create a server projectile and broadcast, once the stage is over
+            world.GetCommandBuffer().Defer(aid, [room = linked->room_id, x = pos->x, y = pos->y](ECS::World &, ECS::EntityID shooter) {
+                ECS::EntityID proj = rtype::server::controllers::room_controller::createServerProjectile(room, shooter, x, y, false);
+                rtype::server::controllers::room_controller::broadcastProjectileSpawn(proj, shooter, room, false);
+                std::cout << "Assistant " << shooter << " shot projectile " << proj << " in room " << room << std::endl;
+            });
             assistantComp->shootCooldown = 0.6f; // 600ms between shots
-            std::cout << "Assistant " << aid << " shot projectile " << proj << " in room " << linked->room_id << std::endl;
         }
     }
 }
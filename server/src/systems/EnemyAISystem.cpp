@@ -4,7 +4,12 @@
 
 namespace rtype::server::systems {
 
-EnemyAISystem::EnemyAISystem() : ECS::System("EnemyAISystem", 40) {}
+EnemyAISystem::EnemyAISystem() : ECS::System("EnemyAISystem", 40) {
+    DeclareRead<rtype::common::components::Team, rtype::common::components::Player,
+                rtype::common::components::Position, rtype::common::components::Health,
+                rtype::common::components::EnemyTypeComponent>();
+    DeclareWrite<rtype::common::components::FireRate>();
+}
 
 void EnemyAISystem::SetProjectileCallback(ProjectileCallback callback) {
     m_createProjectile = callback;
@@ -15,8 +20,12 @@ void EnemyAISystem::Update(ECS::World& world, float deltaTime) {
 
     rtype::common::systems::FireRateSystem::update(world, deltaTime);
 
-    auto createProjectile = [this, &world](ECS::EntityID shooter, float x, float y, float vx, float vy) {
-        m_createProjectile(shooter, x, y, vx, vy, world);
+    // Projectiles are spawned at the end of the stage, this system may run alongside others
+    auto& commands = world.GetCommandBuffer();
+    auto createProjectile = [this, &commands](ECS::EntityID shooter, float x, float y, float vx, float vy) {
+        commands.Defer(shooter, [callback = m_createProjectile, x, y, vx, vy](ECS::World& target, ECS::EntityID entity) {
+            callback(entity, x, y, vx, vy, target);
+        });
     };
 
     rtype::common::systems::EnemyAISystem::update(world, deltaTime, createProjectile);
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PlayerStateSystem - Fixed-rate player state broadcasting
+*/
+
+#include "systems/PlayerStateSystem.h"
+#include "components/LinkedRoom.h"
+#include "components/PlayerConn.h"
+#include "components/RoomProperties.h"
+#include "senders.h"
+#include <common/components/Health.h>
+#include <common/components/Player.h>
+#include <common/components/Position.h>
+#include <unordered_map>
+#include <vector>
+
+namespace rtype::server::systems {
+
+void PlayerStateSystem::Update(ECS::World &world, float)
+{
+    auto *players = world.GetAllComponents<rtype::common::components::Player>();
+    if (!players) return;
+    auto &clients_by_room = world.Index<rtype::server::components::PlayerConn,
+                                        rtype::server::components::PlayerConn::ByRoom>();
+
+    // Networked clients of each room seen this run, empty for rooms still in lobby
+    std::unordered_map<ECS::EntityID, std::vector<ECS::EntityID>> clients;
+
+    for (auto &pair : *players) {
+        ECS::EntityID pid = pair.first;
+
+        // Network players know their room through PlayerConn, server-only entities (assistants) through LinkedRoom
+        ECS::EntityID room = 0;
+        if (auto *pconn = world.GetComponent<rtype::server::components::PlayerConn>(pid)) {
+            room = pconn->room_code;
+        } else if (auto *linked = world.GetComponent<rtype::server::components::LinkedRoom>(pid)) {
+            room = linked->room_id;
+        }
+        if (!room) continue;
+
+        auto recipients = clients.find(room);
+        if (recipients == clients.end()) {
+            auto *rp = world.GetComponent<rtype::server::components::RoomProperties>(room);
+            recipients = clients.emplace(room, rp && rp->isGameStarted ? clients_by_room.Find(room)
+                                                                       : std::vector<ECS::EntityID>()).first;
+        }
+        if (recipients->second.empty()) continue;
+
+        auto *pos = world.GetComponent<rtype::common::components::Position>(pid);
+        auto *health = world.GetComponent<rtype::common::components::Health>(pid);
+        if (!pos || !health) continue;
+
+        // Send this player's state to every networked client in the same room
+        for (ECS::EntityID other : recipients->second) {
+            rtype::server::network::senders::send_player_state(other, pid, pos->x, pos->y, pos->rotation, health->currentHp, health->isAlive);
+        }
+    }
+}
+
+} // namespace rtype::server::systems
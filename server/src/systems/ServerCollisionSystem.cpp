@@ -71,12 +71,20 @@ static int getScoreForEnemyType(rtype::common::components::EnemyType type) {
 
 void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
     rtype::common::systems::CollisionHandlers handlers;
-    std::vector<ECS::EntityID> toDestroy;
+
+    // Destruction is deferred until the collision pass is over; each entity is
+    // broadcast once, right before it is destroyed, however many times it was hit
+    auto& commands = world.GetCommandBuffer();
+    auto destroy = [this, &commands](ECS::EntityID entity) {
+        commands.DestroyEntity(entity, [this](ECS::World& world, ECS::EntityID target) {
+            broadcastEntityDestroyToAllRooms(world, target);
+        });
+    };
 
     // Track projectile-enemy pairs that have already collided this frame
     std::unordered_map<ECS::EntityID, std::unordered_set<ECS::EntityID>> piercingCollisions;
 
-    handlers.onPlayerVsEnemy = [this, &toDestroy](ECS::EntityID player, ECS::EntityID enemy, ECS::World& world) {
+    handlers.onPlayerVsEnemy = [this, &destroy](ECS::EntityID player, ECS::EntityID enemy, ECS::World& world) {
         auto* playerHealth = world.GetComponent<rtype::common::components::Health>(player);
         auto* enemyHealth = world.GetComponent<rtype::common::components::Health>(enemy);
         if (!playerHealth || !enemyHealth) return;
@@ -109,7 +117,7 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
         broadcastPlayerStateImmediate(world, player);
     };
 
-    handlers.onPlayerProjectileVsEnemy = [this, &toDestroy, &piercingCollisions](ECS::EntityID proj, ECS::EntityID enemy, ECS::World& world) {
+    handlers.onPlayerProjectileVsEnemy = [this, &destroy, &piercingCollisions](ECS::EntityID proj, ECS::EntityID enemy, ECS::World& world) {
         auto* projData = world.GetComponent<rtype::common::components::Projectile>(proj);
         auto* enemyHealth = world.GetComponent<rtype::common::components::Health>(enemy);
         if (!projData || !enemyHealth) return;
@@ -134,7 +142,7 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
                 if (!projData->piercing) {
                     // Normal projectile - blocked completely
                     std::cout << "[COLLISION] 🔴 Normal shot BLOCKED by RED SHIELD on boss " << enemy << "! (needs charged shot)" << std::endl;
-                    toDestroy.push_back(proj);
+                    destroy(proj);
                     return;
                 } else {
                     // Charged shot - count the hit
@@ -146,7 +154,7 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
                         shield->isActive = false;
                         std::cout << "[COLLISION] 💥 RED SHIELD BROKEN on boss " << enemy << "! Boss is now vulnerable!" << std::endl;
                     }
-                    toDestroy.push_back(proj);
+                    destroy(proj);
                     return; // No damage yet, just shield hit
                 }
             }
@@ -161,7 +169,7 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
             if (shield->type == rtype::common::components::ShieldType::Cyclic) {
                 if (!projData->piercing) {
                     std::cout << "[COLLISION] 🛡️ Projectile " << proj << " BLOCKED by shield on enemy " << enemy << "! (needs charged/piercing shot)" << std::endl;
-                    toDestroy.push_back(proj);
+                    destroy(proj);
                     return;
                 } else {
                     std::cout << "[COLLISION] ⚡ PIERCING shot " << proj << " BREAKS through cyclic shield of enemy " << enemy << "!" << std::endl;
@@ -225,15 +233,15 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
                 }
             }
 
-            toDestroy.push_back(enemy);
+            destroy(enemy);
         }
 
         if (!projData->piercing) {
-            toDestroy.push_back(proj);
+            destroy(proj);
         }
     };
 
-    handlers.onEnemyProjectileVsPlayer = [this, &toDestroy](ECS::EntityID proj, ECS::EntityID player, ECS::World& world) {
+    handlers.onEnemyProjectileVsPlayer = [this, &destroy](ECS::EntityID proj, ECS::EntityID player, ECS::World& world) {
         auto* projData = world.GetComponent<rtype::common::components::Projectile>(proj);
         auto* playerHealth = world.GetComponent<rtype::common::components::Health>(player);
         if (!projData || !playerHealth) return;
@@ -250,10 +258,10 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
         }
 
         broadcastPlayerStateImmediate(world, player);
-        toDestroy.push_back(proj);
+        destroy(proj);
     };
 
-    handlers.onSuicideExplosion = [this, &toDestroy](ECS::EntityID suicideEnemy, ECS::World& world) {
+    handlers.onSuicideExplosion = [this, &destroy](ECS::EntityID suicideEnemy, ECS::World& world) {
         auto* enemyPos = world.GetComponent<rtype::common::components::Position>(suicideEnemy);
         if (!enemyPos) return;
 
@@ -286,23 +294,10 @@ void ServerCollisionSystem::Update(ECS::World& world, float deltaTime) {
             }
         }
 
-        toDestroy.push_back(suicideEnemy);
+        destroy(suicideEnemy);
     };
 
     rtype::common::systems::CollisionSystem::update(world, deltaTime, handlers);
-
-    std::sort(toDestroy.begin(), toDestroy.end());
-    toDestroy.erase(std::unique(toDestroy.begin(), toDestroy.end()), toDestroy.end());
-
-    // Broadcast destruction before actually destroying entities
-    for (auto entity : toDestroy) {
-        broadcastEntityDestroyToAllRooms(world, entity);
-    }
-    
-    // Now destroy the entities
-    for (auto entity : toDestroy) {
-        world.DestroyEntity(entity);
-    }
 }
 
 void ServerCollisionSystem::broadcastEntityDestroyToAllRooms(
@@ -23,6 +23,30 @@
 #include "senders.h"
 #include "components/LinkedRoom.h"
 
+// ============================================================================
+// HELPER FUNCTIONS - Enemy prefab
+// ============================================================================
+
+// Components shared by every enemy; per-spawn values are written by initEnemy
+static const ECS::Prefab &enemyPrefab() {
+    static const ECS::Prefab prefab = ECS::Prefab("Enemy")
+        .With<rtype::common::components::Position>()
+        .With<rtype::common::components::Velocity>()
+        .With<rtype::common::components::Health>()
+        .With<rtype::common::components::Team>(rtype::common::components::TeamType::Enemy)
+        .With<rtype::common::components::EnemyTypeComponent>();
+    return prefab;
+}
+
+static void initEnemy(ECS::World &world, ECS::EntityID enemy, ECS::EntityID room,
+                      rtype::common::components::EnemyType type, float x, float y, float vx, int hp) {
+    *world.GetComponent<rtype::common::components::Position>(enemy) = rtype::common::components::Position(x, y, 0.0f);
+    *world.GetComponent<rtype::common::components::Velocity>(enemy) = rtype::common::components::Velocity(vx, 0.0f, std::abs(vx));
+    *world.GetComponent<rtype::common::components::Health>(enemy) = rtype::common::components::Health(hp);
+    world.GetComponent<rtype::common::components::EnemyTypeComponent>(enemy)->type = type;
+    rtype::server::services::room_service::linkToRoom(world, enemy, room);
+}
+
 void ServerEnemySystem::Update(ECS::World &world, float deltaTime) {
     // Only update spawn systems if there's at least one active game room
     auto *rooms = world.GetAllComponents<rtype::server::components::RoomProperties>();
@@ -45,13 +69,11 @@ void ServerEnemySystem::Update(ECS::World &world, float deltaTime) {
         checkBossDeathAndAdvanceLevel(world);
     }
 
-    // Always update player state broadcast (needed even in lobby)
-    updatePlayerStateBroadcast(world, deltaTime);
     cleanupDeadEntities(world);
 }
 
 ServerEnemySystem::ServerEnemySystem()
-    : ECS::System("ServerEnemySystem", 5), _levelTimer(0.0f), _currentLevel(0), _phase(EnemySpawnPhase::OnlyBasic), _bossSpawned(false), _gameFinished(false), _stateTick(0.0f)
+    : ECS::System("ServerEnemySystem", 5), _levelTimer(0.0f), _currentLevel(0), _phase(EnemySpawnPhase::OnlyBasic), _bossSpawned(false), _gameFinished(false)
 {
     // Define the 4 sub-levels
     // Level 0: Basic + Shielded + TankDestroyer
@@ -165,13 +187,8 @@ void ServerEnemySystem::updateObstacleSpawning(ECS::World& world, float deltaTim
             int hp = 5;
             float speed = 180.0f + static_cast<float>(rand() % 80); // 180..260
 
-            auto e = root.world.CreateEntity();
-            root.world.AddComponent<rtype::common::components::Position>(e, spawnX, spawnY, 0.0f);
-            root.world.AddComponent<rtype::common::components::Velocity>(e, -speed, 0.0f, speed);
-            root.world.AddComponent<rtype::common::components::Health>(e, hp);
-            root.world.AddComponent<rtype::common::components::Team>(e, rtype::common::components::TeamType::Enemy);
-            root.world.AddComponent<rtype::common::components::EnemyTypeComponent>(e, rtype::common::components::EnemyType::Meteorite);
-            root.world.AddComponent<rtype::server::components::LinkedRoom>(e, room);
+            auto e = root.world.Instantiate(enemyPrefab()).front();
+            initEnemy(root.world, e, room, rtype::common::components::EnemyType::Meteorite, spawnX, spawnY, -speed, hp);
 
             rtype::server::network::senders::broadcast_enemy_spawn(room, e, rtype::common::components::EnemyType::Meteorite, spawnX, spawnY, hp);
         }
@@ -202,22 +219,17 @@ void ServerEnemySystem::spawnDebrisRow(ECS::World& world, ECS::EntityID room, in
     float bottom = 640.0f;
     float step = (bottom - top) / (count - 1);
 
-    for (int i = 0; i < count; ++i) {
+    // The whole row is created in one batch
+    world.Instantiate(enemyPrefab(), count, [&](ECS::EntityID e, std::size_t i) {
         float spawnX = 1280.0f + 60.0f;
         float spawnY = top + step * i;
         int hp = 1000;
         float speed = 80.0f + static_cast<float>(rand() % 40); // 80..120
 
-        auto e = root.world.CreateEntity();
-        root.world.AddComponent<rtype::common::components::Position>(e, spawnX, spawnY, 0.0f);
-        root.world.AddComponent<rtype::common::components::Velocity>(e, -speed, 0.0f, speed);
-        root.world.AddComponent<rtype::common::components::Health>(e, hp);
-        root.world.AddComponent<rtype::common::components::Team>(e, rtype::common::components::TeamType::Enemy);
-        root.world.AddComponent<rtype::common::components::EnemyTypeComponent>(e, rtype::common::components::EnemyType::Debri);
-        root.world.AddComponent<rtype::server::components::LinkedRoom>(e, room);
+        initEnemy(world, e, room, rtype::common::components::EnemyType::Debri, spawnX, spawnY, -speed, hp);
 
         rtype::server::network::senders::broadcast_enemy_spawn(room, e, rtype::common::components::EnemyType::Debri, spawnX, spawnY, hp);
-    }
+    });
 }
 
 // ============================================================================
@@ -264,13 +276,8 @@ void ServerEnemySystem::spawnBoss(ECS::World& world, ECS::EntityID room, rtype::
     }
 
     // Create boss entity on server world
-    auto boss = world.CreateEntity();
-    world.AddComponent<rtype::common::components::Position>(boss, spawnX, spawnY, 0.0f);
-    world.AddComponent<rtype::common::components::Velocity>(boss, vx, 0.0f, std::abs(vx));
-    world.AddComponent<rtype::common::components::Health>(boss, hp);
-    world.AddComponent<rtype::common::components::Team>(boss, rtype::common::components::TeamType::Enemy);
-    world.AddComponent<rtype::common::components::EnemyTypeComponent>(boss, bossType);
-    world.AddComponent<rtype::server::components::LinkedRoom>(boss, room);
+    auto boss = world.Instantiate(enemyPrefab()).front();
+    initEnemy(world, boss, room, bossType, spawnX, spawnY, vx, hp);
 
     std::cout << "SERVER: 🔥 Spawning BOSS " << (int)bossType << " (id=" << boss << ") with " << hp << " HP in room " << room << std::endl;
 
@@ -396,68 +403,6 @@ void ServerEnemySystem::updateEnemySpawning(ECS::World& world, float deltaTime)
     }
 }
 
-// ============================================================================
-// PRIVATE METHODS - Player State Broadcasting
-// ============================================================================
-
-void ServerEnemySystem::updatePlayerStateBroadcast(ECS::World& world, float deltaTime)
-{
-    _stateTick += deltaTime;
-    if (_stateTick < STATE_TICK_INTERVAL) return;
-    
-    _stateTick = 0.0f;
-
-    // Only broadcast player states for rooms where game has started
-    auto *rooms = world.GetAllComponents<rtype::server::components::RoomProperties>();
-    if (!rooms) return;
-    
-    for (auto &roomPair : *rooms) {
-        ECS::EntityID room = roomPair.first;
-        auto *rp = roomPair.second.get();
-        if (!rp || !rp->isGameStarted) continue; // Skip rooms still in lobby
-
-        auto players = world.GetAllComponents<rtype::common::components::Player>();
-        if (!players) continue;
-        
-        for (auto &pair : *players) {
-            ECS::EntityID pid = pair.first;
-
-            // Determine the room for this player entity.
-            // Prefer the PlayerConn->room_code (network players), fall back to LinkedRoom for server-only entities
-            ECS::EntityID playerRoom = 0;
-            auto* pconn = world.GetComponent<rtype::server::components::PlayerConn>(pid);
-            if (pconn) {
-                playerRoom = pconn->room_code;
-            } else {
-                auto* linked = world.GetComponent<rtype::server::components::LinkedRoom>(pid);
-                if (linked) playerRoom = linked->room_id;
-            }
-            if (playerRoom != room) continue; // Skip players not in this room
-
-            auto* pos = world.GetComponent<rtype::common::components::Position>(pid);
-            auto* health = world.GetComponent<rtype::common::components::Health>(pid);
-            if (!pos || !health) continue;
-
-            // Send this player's state to every networked client in the same room
-            auto allPlayers = world.GetAllComponents<rtype::common::components::Player>();
-            if (!allPlayers) continue;
-            for (auto &pp : *allPlayers) {
-                ECS::EntityID other = pp.first;
-                auto* other_room = world.GetComponent<rtype::server::components::LinkedRoom>(other);
-                if (!other_room) continue;
-                // restrict to same room
-                if (other_room->room_id != room) continue;
-
-                // Only actually send to entities that have a PlayerConn (real network clients)
-                auto* otherConn = world.GetComponent<rtype::server::components::PlayerConn>(other);
-                if (!otherConn) continue;
-
-                rtype::server::network::senders::send_player_state(other, pid, pos->x, pos->y, pos->rotation, health->currentHp, health->isAlive);
-            }
-        }
-    }
-}
-
 // ============================================================================
 // PRIVATE METHODS - Entity Cleanup
 // ============================================================================
@@ -466,7 +411,7 @@ void ServerEnemySystem::cleanupDeadEntities(ECS::World& world) {
     auto healths = world.GetAllComponents<rtype::common::components::Health>();
     if (!healths) return;
     
-    std::vector<ECS::EntityID> toDestroy;
+    auto &commands = world.GetCommandBuffer();
     for (auto &pair : *healths) {
         ECS::EntityID eid = pair.first;
         auto* h = pair.second.get();
@@ -477,12 +422,9 @@ void ServerEnemySystem::cleanupDeadEntities(ECS::World& world) {
             // Broadcast destroy packet to all players in the world (could restrict by room)
             if (room)
                 rtype::server::network::senders::broadcast_entity_destroy(room->room_id, static_cast<uint32_t>(eid), 1 /* killed */);
-            toDestroy.push_back(eid);
+            commands.DestroyEntity(eid);
         }
     }
-    for (auto e : toDestroy) {
-        world.DestroyEntity(e);
-    }
 }
 
 // ============================================================================
@@ -548,13 +490,8 @@ void ServerEnemySystem::spawnEnemy(ECS::World &world, ECS::EntityID room, rtype:
             break;
     }
 
-    auto enemy = root.world.CreateEntity();
-    root.world.AddComponent<rtype::common::components::Position>(enemy, spawnX, spawnY, 0.0f);
-    root.world.AddComponent<rtype::common::components::Velocity>(enemy, vx, 0.0f, std::abs(vx));
-    root.world.AddComponent<rtype::common::components::Health>(enemy, hp);
-    root.world.AddComponent<rtype::common::components::Team>(enemy, rtype::common::components::TeamType::Enemy);
-    root.world.AddComponent<rtype::common::components::EnemyTypeComponent>(enemy, type);
-    root.world.AddComponent<rtype::server::components::LinkedRoom>(enemy, room);
+    auto enemy = root.world.Instantiate(enemyPrefab()).front();
+    initEnemy(root.world, enemy, room, type, spawnX, spawnY, vx, hp);
 
     // Add cyclic shield to Shielded enemy type and Turret type
     if (type == rtype::common::components::EnemyType::Shielded || type == rtype::common::components::EnemyType::Turret) {
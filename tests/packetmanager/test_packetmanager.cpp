@@ -12,6 +12,10 @@
 #include <cstring>
 #include <cstdlib>
 #include <string>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <thread>
 
 // Platform-specific network headers
 #ifdef _WIN32
@@ -234,7 +238,7 @@ void testPacketData(TestRunner &runner) {
                            "Data size should match");
 
         // Test data
-        super_packet_t *received_data = (super_packet_t *) packet->data;
+        super_packet_t *received_data = (super_packet_t *) packet->data();
         runner.assertEqual("Data age", 25, received_data->my_age, "Age should be 25");
         runner.assertEqual("Data boolean flag", true, received_data->im_gay, "Boolean flag should be true");
         runner.assertStringEqual("Data name", "John Doe", received_data->my_name, "Name should be 'John Doe'");
@@ -290,49 +294,54 @@ void testMissingPacketsAndAck(TestRunner &runner) {
 
     // Check missed packets list
     std::vector<uint32_t> missed_packets = receiver._get_missed_packets();
-    runner.assertEqual("Missed packets count", 0UL, missed_packets.size(),
-                       "Should detect 0 missing packet (already concerted to a pending ack packet)");
+    runner.assertEqual("Missed packets count", 1UL, missed_packets.size(),
+                       "Should detect 1 missing packet in the acknowledgement window");
     if (!missed_packets.empty()) {
         runner.assertEqual("Missing packet seqid", 2U, missed_packets[0], "Should detect packet 2 as missing");
     }
 
-    // Check that receiver generated ACK packets for missing packet
+    // A loss is reported at once, in a single header-only acknowledgement
     std::vector<std::unique_ptr<packet_t> > ack_packets = receiver.fetchPacketsToSend();
-    runner.assertTrue("ACK packets generated", !ack_packets.empty(), "Should generate ACK packets for missing packet");
+    runner.assertEqual("One ACK packet generated", 1UL, ack_packets.size(),
+                       "Should generate a single ACK packet for the missing packet");
 
     if (!ack_packets.empty()) {
-        // Find ACK packet for seqid=2
-        bool found_ack_for_2 = false;
-        for (const auto &ack_packet: ack_packets) {
-            if (ack_packet->header.ack == 2) {
-                found_ack_for_2 = true;
-                runner.assertEqual("ACK packet type", (uint8_t) 0, ack_packet->header.type,
-                                   "ACK packet should have type 0");
-                runner.assertEqual("ACK packet seqid", 0U, ack_packet->header.seqid, "ACK packet should have seqid 0");
-                runner.assertEqual("ACK packet data_size", 0U, ack_packet->header.data_size,
-                                   "ACK packet should have no data");
-                runner.assertTrue("ACK packet data is null", ack_packet->data == nullptr,
-                                  "ACK packet should have null data");
-                break;
-            }
-        }
-        runner.assertTrue("ACK for missing packet 2", found_ack_for_2, "Should generate ACK packet with ack=2");
+        const packet_t &ack_packet = *ack_packets[0];
+        runner.assertEqual("ACK packet type", (uint8_t) 0, ack_packet.header.type, "ACK packet should have type 0");
+        runner.assertEqual("ACK packet seqid", 0U, ack_packet.header.seqid, "ACK packet should have seqid 0");
+        runner.assertEqual("ACK packet data_size", 0U, ack_packet.header.data_size, "ACK packet should have no data");
+        runner.assertTrue("ACK packet data is null", ack_packet.data() == nullptr, "ACK packet should have null data");
+        runner.assertEqual("ACK packet latest seqid", 3U, ack_packet.header.ack, "ACK should carry seqid 3");
+        runner.assertEqual("ACK packet bitfield", (uint64_t) 0x2, ack_packet.header.ack_bits,
+                           "Bitfield should mark packet 1 received and packet 2 missing");
     }
 
-    // Test received packets - should only have packet 1 and 3
+    // Test received packets - packet 3 waits for packet 2
     std::vector<std::unique_ptr<packet_t> > received_packets = receiver.fetchReceivedPackets();
-    runner.assertEqual("Received packets count", 2UL, received_packets.size(), "Should receive 2 packets (1 and 3)");
+    runner.assertEqual("Received packets count", 1UL, received_packets.size(), "Should deliver packet 1 only");
+
+    // The retransmission of packet 2 releases packet 3
+    if (packets_to_send.size() > 1) {
+        std::vector<uint8_t> raw_packet2 = PacketManager::serializePacket(*packets_to_send[1]);
+        receiver.handlePacketBytes(raw_packet2.data(), raw_packet2.size(), (sockaddr_in){});
+    }
+    std::vector<std::unique_ptr<packet_t> > late_packets = receiver.fetchReceivedPackets();
+    runner.assertEqual("Late packets count", 2UL, late_packets.size(), "Should deliver packets 2 and 3");
+    received_packets.insert(received_packets.end(), std::make_move_iterator(late_packets.begin()),
+                            std::make_move_iterator(late_packets.end()));
 
-    if (received_packets.size() >= 2) {
-        // Packets should be sorted by seqid
+    if (received_packets.size() >= 3) {
+        // Packets should come in seqid order
         runner.assertEqual("First received packet seqid", 1U, received_packets[0]->header.seqid,
                            "First packet should be seqid=1");
-        runner.assertEqual("Second received packet seqid", 3U, received_packets[1]->header.seqid,
-                           "Second packet should be seqid=3");
+        runner.assertEqual("Second received packet seqid", 2U, received_packets[1]->header.seqid,
+                           "Second packet should be seqid=2");
+        runner.assertEqual("Third received packet seqid", 3U, received_packets[2]->header.seqid,
+                           "Third packet should be seqid=3");
 
         // Check data content
-        super_packet_t *data1_received = (super_packet_t *) received_packets[0]->data;
-        super_packet_t *data3_received = (super_packet_t *) received_packets[1]->data;
+        super_packet_t *data1_received = (super_packet_t *) received_packets[0]->data();
+        super_packet_t *data3_received = (super_packet_t *) received_packets[2]->data();
 
         runner.assertStringEqual("Packet 1 data", "Packet 1", data1_received->my_name,
                                  "Packet 1 should contain 'Packet 1'");
@@ -382,21 +391,31 @@ void testAckPacketRetransmission(TestRunner &runner) {
 
     // Send ACK back to sender to test retransmission logic
     if (!ack_packets.empty()) {
-        for (const auto &ack_packet: ack_packets) {
-            if (ack_packet->header.ack == 1) {
-                // ACK for missing packet 1
-                std::vector<uint8_t> ack_raw = PacketManager::serializePacket(*ack_packet);
-                sender.handlePacketBytes(ack_raw.data(), ack_raw.size(), (sockaddr_in){});
-                runner.assertTrue("ACK processed by sender", true, "Sender should process ACK packet");
-                break;
-            }
-        }
+        runner.assertTrue("ACK reports packet 1 missing",
+                          ack_packets[0]->header.ack == 2 && (ack_packets[0]->header.ack_bits & 1) == 0,
+                          "Bit 0 of the ACK should be clear for packet 1");
+        std::vector<uint8_t> ack_raw = PacketManager::serializePacket(*ack_packets[0]);
+        sender.handlePacketBytes(ack_raw.data(), ack_raw.size(), (sockaddr_in){});
     }
 
-    // Check that sender queues packet for retransmission
+    // Check that sender queues packet for retransmission, and only the missing one
     std::vector<std::unique_ptr<packet_t> > retrans_packets = sender.fetchPacketsToSend();
-    runner.assertTrue("Retransmission packets queued", !retrans_packets.empty(),
-                      "Sender should queue packets for retransmission after ACK");
+    runner.assertEqual("Retransmission packets queued", 1UL, retrans_packets.size(),
+                       "Sender should queue packet 1 for retransmission after ACK");
+    if (!retrans_packets.empty()) {
+        runner.assertEqual("Retransmitted seqid", 1U, retrans_packets[0]->header.seqid, "Packet 1 should be resent");
+    }
+    std::vector<packet_t> history = sender._get_history_sent();
+    runner.assertTrue("Acknowledged packet leaves history", history.size() == 1 && history[0].header.seqid == 1,
+                      "Only the unacknowledged packet 1 should stay in history");
+
+    // The same report again does not trigger another retransmission
+    if (!ack_packets.empty()) {
+        std::vector<uint8_t> ack_raw = PacketManager::serializePacket(*ack_packets[0]);
+        sender.handlePacketBytes(ack_raw.data(), ack_raw.size(), (sockaddr_in){});
+    }
+    runner.assertEqual("No duplicate retransmission", 0UL, sender.fetchPacketsToSend().size(),
+                       "A repeated report should not resend packet 1 again right away");
 
     // Cleanup
     free(data);
@@ -456,7 +475,7 @@ void emptyPacketDataIsHandledCorrectly(TestRunner &runner) {
     if (!packets.empty()) {
         runner.assertEqual("Empty packet data size", 0U, packets[0]->header.data_size,
                            "Empty packet should have data_size=0");
-        runner.assertTrue("Empty packet data is null", packets[0]->data == nullptr, "Empty packet data should be null");
+        runner.assertTrue("Empty packet data is null", packets[0]->data() == nullptr, "Empty packet data should be null");
     }
 }
 
@@ -532,11 +551,16 @@ void multipleConsecutiveMissingPacketsAreDetected(TestRunner &runner) {
     }
 
     std::vector<uint32_t> missed_packets = receiver._get_missed_packets();
-    runner.assertEqual("Multiple consecutive missing packets detected", 0UL, missed_packets.size(),
-                       "Missing packets should be converted to ACKs");
+    runner.assertEqual("Multiple consecutive missing packets detected", 3UL, missed_packets.size(),
+                       "Packets 2, 3 and 4 should be missing");
 
     std::vector<std::unique_ptr<packet_t> > ack_packets = receiver.fetchPacketsToSend();
-    runner.assertTrue("Multiple ACKs generated", ack_packets.size() >= 3, "Should generate ACKs for packets 2, 3, 4");
+    runner.assertEqual("One ACK covers every loss", 1UL, ack_packets.size(),
+                       "A single ACK should report packets 2, 3 and 4");
+    if (!ack_packets.empty()) {
+        runner.assertEqual("Bitfield of the losses", (uint64_t) 0x8, ack_packets[0]->header.ack_bits,
+                           "Only packet 1 should be marked received before packet 5");
+    }
 }
 
 void duplicatePacketsAreHandledCorrectly(TestRunner &runner) {
@@ -558,8 +582,8 @@ void duplicatePacketsAreHandledCorrectly(TestRunner &runner) {
     }
 
     std::vector<std::unique_ptr<packet_t> > received_packets = receiver.fetchReceivedPackets();
-    runner.assertEqual("Duplicate packet handling", 2UL, received_packets.size(),
-                       "Duplicate packets should be processed");
+    runner.assertEqual("Duplicate packet handling", 1UL, received_packets.size(),
+                       "Duplicate packets should be delivered once");
 
     free(data);
 }
@@ -631,7 +655,7 @@ void corruptedDataFieldIsDetected(TestRunner &runner) {
 
     std::vector<std::unique_ptr<packet_t> > received_packets = receiver.fetchReceivedPackets();
     if (!received_packets.empty()) {
-        super_packet_t *received_data = (super_packet_t *) received_packets[0]->data;
+        super_packet_t *received_data = (super_packet_t *) received_packets[0]->data();
         runner.assertTrue("Corrupted data field detected",
                           strcmp(received_data->my_name, "Original Data") != 0,
                           "Corrupted data should be different from original");
@@ -684,6 +708,302 @@ void extremelySmallPacketIsHandled(TestRunner &runner) {
                        "Tiny packets should be rejected");
 }
 
+void sentPayloadIsSharedNotCopied(TestRunner &runner) {
+    PacketManager manager;
+    super_packet_t testPacket = PacketTestHelper::createTestPacket(7, false, "Shared");
+    size_t output_size;
+
+    manager.setCompressionEnabled(false);
+    PacketBuffer wire = manager.sendPacketBytesSafe(&testPacket, sizeof(testPacket), 1, &output_size, true);
+    std::vector<std::unique_ptr<packet_t> > packets = manager.fetchPacketsToSend();
+    std::vector<packet_t> history = manager._get_history_sent();
+
+    runner.assertEqual("Serialized size", sizeof(packet_header_t) + sizeof(super_packet_t), output_size,
+                       "Output size should be header + payload");
+    if (!packets.empty() && !history.empty()) {
+        runner.assertTrue("Send queue shares the returned buffer", packets[0]->data() == wire.payload(),
+                          "Queued packet should point into the returned buffer");
+        runner.assertTrue("History shares the returned buffer", history[0].data() == wire.payload(),
+                          "History should point into the returned buffer");
+
+        size_t wire_size = 0;
+        const uint8_t *bytes = PacketManager::wireBytes(*packets[0], &wire_size);
+        runner.assertTrue("Wire bytes are the buffer", bytes == wire.bytes() && wire_size == output_size,
+                          "Sending should not copy the packet");
+        runner.assertTrue("Header written in the header room",
+                          std::memcmp(bytes, &packets[0]->header, sizeof(packet_header_t)) == 0,
+                          "Header should precede the payload");
+    }
+}
+
+void packetBuffersAreRecycled(TestRunner &runner) {
+    PacketBuffer first = PacketBuffer::allocate(100);
+    runner.assertTrue("Payload capacity rounded up", first.capacity() >= 100 && first.payloadSize() == 100,
+                      "Buffer should hold at least the requested payload");
+    runner.assertTrue("Payload is aligned", reinterpret_cast<uintptr_t>(first.payload()) % alignof(std::max_align_t) == 0,
+                      "Payload should be castable to packet structs");
+
+    PacketBuffer copy = first;
+    runner.assertEqual("Copies share the block", 2L, first.useCount(), "Copy should bump the reference count");
+
+    uint8_t *block = first.bytes();
+    size_t pooled = PacketBuffer::pooledBlocks();
+    first = PacketBuffer();
+    copy = PacketBuffer();
+    runner.assertEqual("Last release returns the block", pooled + 1, PacketBuffer::pooledBlocks(),
+                       "Block should go back to the pool");
+
+    PacketBuffer second = PacketBuffer::allocate(90);
+    runner.assertTrue("Block reused", second.bytes() == block, "Allocation should reuse the pooled block");
+}
+
+void historyRingKeepsNewestPackets(TestRunner &runner) {
+    PacketManager manager;
+    manager.setCompressionEnabled(false);
+    manager.setHistoryLimits(4, PACKET_HISTORY_BYTES);
+
+    for (int i = 1; i <= 6; i++) {
+        super_packet_t packet = PacketTestHelper::createTestPacket(i, true, ("Ring " + std::to_string(i)).c_str());
+        manager.sendPacketBytesSafe(&packet, sizeof(packet), 1, nullptr, true);
+    }
+    manager.fetchPacketsToSend();
+
+    std::vector<packet_t> history = manager._get_history_sent();
+    runner.assertEqual("History capped by packet count", 4UL, history.size(), "Ring should keep 4 packets");
+    if (history.size() == 4) {
+        runner.assertEqual("Oldest kept packet", 3U, history.front().header.seqid, "Packets 1 and 2 should be dropped");
+        runner.assertEqual("Newest kept packet", 6U, history.back().header.seqid, "Packet 6 should be kept");
+    }
+    const size_t packet_bytes = sizeof(packet_header_t) + sizeof(super_packet_t);
+    runner.assertEqual("History bytes", 4 * packet_bytes, manager._get_history_bytes(),
+                       "History should count the wire size of its packets");
+
+    manager.setHistoryLimits(4, 2 * packet_bytes);
+    history = manager._get_history_sent();
+    runner.assertEqual("History capped by byte budget", 2UL, history.size(), "Budget should keep 2 packets");
+    if (history.size() == 2) {
+        runner.assertEqual("Budget drops the oldest", 5U, history.front().header.seqid,
+                           "Packets 5 and 6 should be kept");
+    }
+}
+
+void acknowledgementsRideOnOutgoingPackets(TestRunner &runner) {
+    PacketManager client, server;
+
+    super_packet_t input = PacketTestHelper::createTestPacket(1, true, "Input");
+    client.sendPacketBytesSafe(&input, sizeof(input), 1, nullptr, true);
+    PacketTestHelper::transferPacket(client, server);
+
+    // In-order receipts wait for traffic to ride on
+    runner.assertEqual("No standalone ACK without loss", 0UL, server.fetchPacketsToSend().size(),
+                       "Receipt should not be sent alone right away");
+
+    super_packet_t state = PacketTestHelper::createTestPacket(2, true, "State");
+    server.sendPacketBytesSafe(&state, sizeof(state), 1, nullptr, true);
+    std::vector<std::unique_ptr<packet_t> > packets = server.fetchPacketsToSend();
+    runner.assertEqual("Only the game packet is sent", 1UL, packets.size(), "ACK should ride on the state packet");
+    if (!packets.empty()) {
+        runner.assertEqual("Piggybacked ACK", 1U, packets[0]->header.ack, "State packet should acknowledge seqid 1");
+
+        size_t size = 0;
+        const uint8_t *bytes = PacketManager::wireBytes(*packets[0], &size);
+        client.handlePacketBytes(bytes, size, (sockaddr_in){});
+    }
+    runner.assertEqual("Client history emptied by the ACK", 0UL, client._get_history_sent().size(),
+                       "Acknowledged packet should leave the history");
+    runner.assertEqual("Game packet still delivered", 1UL, client.fetchReceivedPackets().size(),
+                       "Packet carrying the ACK should be delivered");
+
+    client.ackMissing();
+    packets = client.fetchPacketsToSend();
+    runner.assertTrue("Forced ACK", packets.size() == 1 && packets[0]->header.ack == 1 &&
+                      packets[0]->header.seqid == 0, "ackMissing() should queue a header-only ACK");
+}
+
+void acknowledgementAheadOfSenderIsIgnored(TestRunner &runner) {
+    PacketManager server;
+    const uint8_t byte = 42;
+    for (int i = 0; i < 3; i++) {
+        server.sendPacketBytesSafe(&byte, 1, 1, nullptr, true);
+    }
+    server.fetchPacketsToSend();
+
+    // A client that kept the receive state of an older session
+    packet_t stale{};
+    stale.header.type = 1;
+    stale.header.ack = 5000;
+    stale.header.ack_bits = 0;
+    std::vector<uint8_t> raw = PacketManager::serializePacket(stale);
+    server.handlePacketBytes(raw.data(), raw.size(), (sockaddr_in){});
+
+    runner.assertEqual("History kept", 3UL, server._get_history_sent().size(),
+                       "An ACK beyond the last seqid sent should not flush the history");
+    runner.assertEqual("Nothing resent", 0UL, server.fetchPacketsToSend().size(),
+                       "An ACK beyond the last seqid sent should not trigger retransmissions");
+}
+
+void unacknowledgedPacketsAreResentOnTimeout(TestRunner &runner) {
+    PacketManager server;
+    const uint8_t byte = 42;
+    for (int i = 0; i < 3; i++) {
+        server.sendPacketBytesSafe(&byte, 1, 1, nullptr, true);
+    }
+    server.fetchPacketsToSend();
+
+    // The client got the first packet only, then went silent
+    packet_t ack{};
+    ack.header.ack = 1;
+    ack.header.ack_bits = 0;
+    std::vector<uint8_t> raw = PacketManager::serializePacket(ack);
+    server.handlePacketBytes(raw.data(), raw.size(), (sockaddr_in){});
+
+    runner.assertEqual("Nothing resent before the timeout", 0UL, server.fetchPacketsToSend().size(),
+                       "Packets sent after the ACK are not reported missing yet");
+    std::this_thread::sleep_for(std::chrono::milliseconds(4 * PACKET_INITIAL_RTT_MS));
+    std::vector<std::unique_ptr<packet_t> > packets = server.fetchPacketsToSend();
+    runner.assertTrue("Lost packets resent without new ACK", packets.size() == 2 && packets[0]->header.seqid == 2 &&
+                      packets[1]->header.seqid == 3, "Overdue packets should be resent on timeout");
+    runner.assertEqual("Resent packets kept", 2UL, server._get_history_sent().size(),
+                       "Packets stay in the history until acknowledged");
+    runner.assertEqual("Timeout restarted", 0UL, server.fetchPacketsToSend().size(),
+                       "A resent packet should wait a new timeout");
+}
+
+void reorderWindowHandlesWraparoundAndHoles(TestRunner &runner) {
+    PacketManager receiver;
+    auto deliver = [&receiver](uint32_t seqid) {
+        packet_t packet{};
+        packet.header.seqid = seqid;
+        packet.header.type = 1;
+        std::vector<uint8_t> raw = PacketManager::serializePacket(packet);
+        receiver.handlePacketBytes(raw.data(), raw.size(), (sockaddr_in){});
+    };
+    auto seqids = [&receiver]() {
+        std::vector<uint32_t> out;
+        for (const auto &packet: receiver.fetchReceivedPackets()) {
+            out.push_back(packet->header.seqid);
+        }
+        return out;
+    };
+
+    // Sequence IDs wrap from UINT32_MAX to 1 (0 is reserved for unreliable packets)
+    receiver.resumeAfter(UINT32_MAX - 2);
+    deliver(1);
+    deliver(UINT32_MAX);
+    runner.assertTrue("Held across the wrap", seqids().empty(), "Packets should wait for UINT32_MAX - 1");
+    deliver(UINT32_MAX - 1);
+    runner.assertTrue("Delivered across the wrap", seqids() == std::vector<uint32_t>({UINT32_MAX - 1, UINT32_MAX, 1}),
+                      "Packets should be delivered in order across the wraparound");
+
+    receiver.clean();
+    deliver(1);
+    deliver(3);
+    deliver(3 + PACKET_REORDER_WINDOW);
+    runner.assertTrue("Window holds at the hole", seqids() == std::vector<uint32_t>({1}),
+                      "Packet 3 should wait for 2 and the packet beyond the window be refused");
+    runner.assertEqual("Refused packet not acknowledged", 3U, receiver._get_recv_seqid(),
+                       "The sender should keep the refused packet to resend it");
+    deliver(2);
+    runner.assertTrue("Hole recovered after retransmission", seqids() == std::vector<uint32_t>({2, 3}),
+                      "The resent packet 2 should be delivered, then 3");
+    for (uint32_t seqid = 4; seqid <= 3 + PACKET_REORDER_WINDOW; seqid++) {
+        deliver(seqid);
+    }
+    std::vector<uint32_t> resumed = seqids();
+    runner.assertTrue("Refused packet accepted once resent", resumed.size() == PACKET_REORDER_WINDOW &&
+                      resumed.back() == 3 + PACKET_REORDER_WINDOW, "Delivery should go on up to the resent packet");
+
+    receiver.clean();
+    deliver(1);
+    deliver(1);
+    deliver(3);
+    deliver(3);
+    deliver(2);
+    deliver(2);
+    runner.assertTrue("Duplicates suppressed in the window", seqids() == std::vector<uint32_t>({1, 2, 3}),
+                      "Each packet should be delivered once, in order");
+
+    receiver.setSequencingEnabled(false);
+    deliver(2);
+    deliver(1);
+    runner.assertTrue("Unsequenced endpoint delivers as received", seqids() == std::vector<uint32_t>({2, 1}),
+                      "Shared endpoints should not reorder nor deduplicate");
+}
+
+void cleanedReceiverAcceptsNewSession(TestRunner &runner) {
+    PacketManager receiver;
+    auto transfer = [&receiver](PacketManager &sender, int count) {
+        const uint8_t byte = 42;
+        for (int i = 0; i < count; i++) {
+            sender.sendPacketBytesSafe(&byte, 1, 1, nullptr, true);
+        }
+        for (auto &packet: sender.fetchPacketsToSend()) {
+            std::vector<uint8_t> raw = PacketManager::serializePacket(*packet);
+            receiver.handlePacketBytes(raw.data(), raw.size(), (sockaddr_in){});
+        }
+        return receiver.fetchReceivedPackets().size();
+    };
+
+    PacketManager first_session;
+    runner.assertEqual("First session delivered", 100UL, transfer(first_session, 100), "All packets should be delivered");
+
+    // A reconnection talks to a fresh manager, numbering from seqid 1 again
+    receiver.clean();
+    PacketManager second_session;
+    runner.assertEqual("Second session delivered", 1UL, transfer(second_session, 1),
+                       "A cleaned receiver should not take seqid 1 for a duplicate");
+}
+
+void smallMessagesShareDatagrams(TestRunner &runner) {
+    PacketManager sender;
+    PacketManager receiver;
+    const uint8_t state[4] = {1, 2, 3, 4};
+    sender.sendPacketBytesSafe(state, sizeof(state), 7, nullptr, true);
+    sender.sendPacketBytesSafe(state, 2, 9, nullptr, false);
+    sender.sendPacketBytesSafe(nullptr, 0, 10, nullptr, true);
+
+    auto datagrams = sender.fetchDatagramsToSend();
+    runner.assertEqual("Messages coalesced", 1UL, datagrams.size(), "Three small messages should fit one datagram");
+    runner.assertEqual("History keeps the messages", 2UL, sender._get_history_sent().size(),
+                       "Important messages should still be tracked one by one");
+    for (auto &datagram: datagrams) {
+        size_t size = 0;
+        const uint8_t *bytes = PacketManager::wireBytes(*datagram, &size);
+        receiver.handlePacketBytes(bytes, size, (sockaddr_in){});
+    }
+    auto received = receiver.fetchReceivedPackets();
+    runner.assertEqual("Messages split on receipt", 3UL, received.size(), "Bundle should yield its three messages");
+    if (received.size() == 3) {
+        runner.assertTrue("Messages keep their header", received[0]->header.seqid == 1 && received[0]->header.type == 7 &&
+                          received[1]->header.seqid == 0 && received[1]->header.type == 9 &&
+                          received[2]->header.seqid == 2 && received[2]->header.type == 10,
+                          "Sequence IDs and types should survive the bundle");
+        runner.assertTrue("Messages keep their payload", received[0]->header.data_size == 4 &&
+                          std::memcmp(received[0]->data(), state, 4) == 0 && received[1]->header.data_size == 2 &&
+                          received[2]->data() == nullptr, "Payloads should survive the bundle");
+    }
+
+    // A datagram budget fitting one message at a time leaves them alone
+    sender.setMtu(sizeof(packet_header_t) + PACKET_MESSAGE_HEADER_SIZE + sizeof(state));
+    sender.sendPacketBytesSafe(state, sizeof(state), 7, nullptr, true);
+    sender.sendPacketBytesSafe(state, sizeof(state), 7, nullptr, true);
+    datagrams = sender.fetchDatagramsToSend();
+    runner.assertTrue("Small MTU splits", datagrams.size() == 2 && datagrams[0]->header.seqid == 3 &&
+                      datagrams[1]->header.seqid == 4, "Each message should go in its own datagram");
+
+    // Compressed payloads go alone, between the bundles around them
+    sender.setMtu(PACKET_DEFAULT_MTU);
+    std::vector<uint8_t> level(600, 0);
+    sender.sendPacketBytesSafe(state, 1, 7, nullptr, false);
+    sender.sendPacketBytesSafe(state, 1, 7, nullptr, false);
+    sender.sendPacketBytesSafe(level.data(), level.size(), 8, nullptr, true);
+    sender.sendPacketBytesSafe(state, 1, 7, nullptr, false);
+    datagrams = sender.fetchDatagramsToSend();
+    runner.assertTrue("Compressed packet alone", datagrams.size() == 3 &&
+                      datagrams[0]->header.type == PACKET_TYPE_BUNDLE && datagrams[1]->header.type == 8 &&
+                      datagrams[2]->header.type == 7, "Only the small uncompressed run should be bundled");
+}
+
 int main() {
     TestRunner runner;
 
@@ -707,6 +1027,15 @@ int main() {
     corruptedDataFieldIsDetected(runner);
     packetManagerCleanupWorksCorrectly(runner);
     extremelySmallPacketIsHandled(runner);
+    sentPayloadIsSharedNotCopied(runner);
+    packetBuffersAreRecycled(runner);
+    historyRingKeepsNewestPackets(runner);
+    acknowledgementsRideOnOutgoingPackets(runner);
+    acknowledgementAheadOfSenderIsIgnored(runner);
+    unacknowledgedPacketsAreResentOnTimeout(runner);
+    reorderWindowHandlesWraparoundAndHoles(runner);
+    cleanedReceiverAcceptsNewSession(runner);
+    smallMessagesShareDatagrams(runner);
 
     // Print results
     TestResult result = runner.getResult();
@@ -1,5 +1,16 @@
 #include <ECS/ECS.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 // Test components
 class TestPosition : public ECS::Component<TestPosition> {
@@ -164,6 +175,1304 @@ int main() {
         }
     }
 
+    // Test 7: Packed storage keeps lookups valid across swap-and-pop removal
+    {
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 10; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestHealth>(entity, i);
+            entities.push_back(entity);
+        }
+
+        world.RemoveComponent<TestHealth>(entities[0]);
+        world.DestroyEntity(entities[4]);
+
+        bool lookupsOk = true;
+        for (int i = 0; i < 10; ++i) {
+            auto* health = world.GetComponent<TestHealth>(entities[i]);
+            bool shouldExist = (i != 0 && i != 4);
+            if ((health != nullptr) != shouldExist || (health && health->hp != i)) {
+                lookupsOk = false;
+            }
+        }
+
+        int iterated = 0;
+        int hpSum = 0;
+        for (auto& [entity, healthPtr] : *world.GetAllComponents<TestHealth>()) {
+            if (world.GetComponent<TestHealth>(entity) != healthPtr.get()) {
+                lookupsOk = false;
+            }
+            hpSum += healthPtr->hp;
+            ++iterated;
+        }
+
+        if (!lookupsOk || iterated != 8 || hpSum != 45 - 4) {
+            std::cout << "FAIL: Packed component storage" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Packed component storage" << std::endl;
+        }
+    }
+
+    // Test 8: Multi-component views with exclusion
+    {
+        ECS::World world;
+        for (int i = 0; i < 20; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+            if (i % 2 == 0) {
+                world.AddComponent<TestVelocity>(entity, 1.0f, 0.0f);
+            }
+            if (i % 4 == 0) {
+                world.AddComponent<TestHealth>(entity, i);
+            }
+        }
+
+        int eachCount = 0;
+        world.View<TestPosition, TestVelocity>().Each([&eachCount](TestPosition& pos, TestVelocity& vel) {
+            pos.x += vel.vx;
+            ++eachCount;
+        });
+
+        int rangeCount = 0;
+        bool valuesOk = true;
+        for (auto [entity, pos, vel] : world.View<TestPosition, TestVelocity>(ECS::Exclude<TestHealth>{})) {
+            if (world.HasComponent<TestHealth>(entity) || &pos != world.GetComponent<TestPosition>(entity)) {
+                valuesOk = false;
+            }
+            ++rangeCount;
+        }
+
+        if (eachCount != 10 || rangeCount != 5 || !valuesOk) {
+            std::cout << "FAIL: Multi-component views" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Multi-component views" << std::endl;
+        }
+    }
+
+    // Test 9: Persistent groups stay in sync with component changes
+    {
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 20; ++i) {
+            auto entity = world.CreateEntity();
+            entities.push_back(entity);
+            world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+            if (i % 2 == 0) {
+                world.AddComponent<TestVelocity>(entity, 1.0f, 0.0f);
+            }
+        }
+
+        auto& owning = world.Group<TestPosition, TestVelocity>();
+        auto& observing = world.Group<>(ECS::With<TestPosition, TestHealth>{});
+        bool groupsOk = owning.Size() == 10 && observing.Size() == 0;
+
+        // Incremental updates: add, remove, destroy
+        world.AddComponent<TestVelocity>(entities[1], 2.0f, 0.0f);
+        world.AddComponent<TestHealth>(entities[3], 50);
+        world.RemoveComponent<TestVelocity>(entities[0]);
+        world.DestroyEntity(entities[2]);
+        groupsOk = groupsOk && owning.Size() == 9 && observing.Size() == 1
+            && owning.Contains(entities[1]) && !owning.Contains(entities[0]) && observing.Contains(entities[3]);
+
+        // Group iteration must match a view and see the right components
+        int viewCount = 0;
+        world.View<TestPosition, TestVelocity>().Each([&viewCount](TestPosition&, TestVelocity&) { ++viewCount; });
+        int groupCount = 0;
+        owning.Each([&](ECS::EntityID entity, TestPosition& pos, TestVelocity& vel) {
+            if (&pos != world.GetComponent<TestPosition>(entity) || &vel != world.GetComponent<TestVelocity>(entity)) {
+                groupsOk = false;
+            }
+            ++groupCount;
+        });
+
+        // Destroying members while iterating must not skip any of them
+        int visited = 0;
+        owning.Each([&](ECS::EntityID entity, TestPosition&, TestVelocity&) {
+            ++visited;
+            world.DestroyEntity(entity);
+        });
+
+        if (!groupsOk || groupCount != viewCount || visited != 9 || owning.Size() != 0 || &world.Group<TestPosition, TestVelocity>() != &owning) {
+            std::cout << "FAIL: Persistent groups" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Persistent groups" << std::endl;
+        }
+    }
+
+    // Test 10: Group vs view iteration micro-benchmark (informational, no timing assertion)
+    {
+        constexpr int ENTITY_COUNT = 20000;
+        constexpr int ITERATIONS = 200;
+
+        auto populate = [](ECS::World& world) {
+            for (int i = 0; i < ENTITY_COUNT; ++i) {
+                auto entity = world.CreateEntity();
+                world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+                if (i % 3 != 0) {
+                    world.AddComponent<TestHealth>(entity, i);
+                }
+                if (i % 2 == 0) {
+                    world.AddComponent<TestVelocity>(entity, 1.0f, 1.0f);
+                }
+            }
+        };
+
+        ECS::World viewWorld;
+        ECS::World groupWorld;
+        populate(viewWorld);
+        populate(groupWorld);
+        auto& group = groupWorld.Group<TestPosition, TestVelocity>();
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            viewWorld.View<TestPosition, TestVelocity>().Each([](TestPosition& pos, TestVelocity& vel) {
+                pos.x += vel.vx;
+                pos.y += vel.vy;
+            });
+        }
+        auto viewTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            group.Each([](TestPosition& pos, TestVelocity& vel) {
+                pos.x += vel.vx;
+                pos.y += vel.vy;
+            });
+        }
+        auto groupTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        float viewSum = 0.0f;
+        float groupSum = 0.0f;
+        viewWorld.View<TestPosition, TestVelocity>().Each([&viewSum](TestPosition& pos, TestVelocity&) { viewSum += pos.y; });
+        group.Each([&groupSum](TestPosition& pos, TestVelocity&) { groupSum += pos.y; });
+
+        std::cout << "INFO: " << ENTITY_COUNT / 2 << " matches x " << ITERATIONS << " passes: view "
+                  << viewTime.count() << "us, owning group " << groupTime.count() << "us" << std::endl;
+
+        if (group.Size() != ENTITY_COUNT / 2 || viewSum != groupSum) {
+            std::cout << "FAIL: Group benchmark results" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Group benchmark results" << std::endl;
+        }
+    }
+
+    // Test 11: Generational handles never alias a recycled slot
+    {
+        ECS::World world;
+        auto stale = world.CreateEntity();
+        world.AddComponent<TestHealth>(stale, 10);
+        auto other = world.CreateEntity();
+        world.DestroyEntity(stale);
+        auto reused = world.CreateEntity();
+
+        bool handlesOk = ECS::GetEntityIndex(reused) == ECS::GetEntityIndex(stale) && reused != stale
+            && !world.IsEntityAlive(stale) && world.IsEntityAlive(reused)
+            && world.AddComponent<TestHealth>(stale, 1) == nullptr;
+
+        world.AddComponent<TestHealth>(reused, 20);
+        handlesOk = handlesOk && !world.HasComponent<TestHealth>(stale) && world.GetComponent<TestHealth>(stale) == nullptr
+            && world.GetComponent<TestHealth>(reused)->hp == 20;
+
+        // Destroying through a stale handle must not touch the new entity
+        world.DestroyEntity(stale);
+        const auto& alive = world.GetAllEntities();
+        handlesOk = handlesOk && world.IsEntityAlive(reused) && world.GetAliveEntityCount() == 2 && alive.size() == 2
+            && &alive == &world.GetAllEntities();
+
+        world.Clear();
+        handlesOk = handlesOk && !world.IsEntityAlive(other) && world.GetAliveEntityCount() == 0
+            && world.CreateEntity() != other;
+
+        if (!handlesOk) {
+            std::cout << "FAIL: Generational entity handles" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Generational entity handles" << std::endl;
+        }
+    }
+
+    // Test 12: Component signatures
+    {
+        ECS::World world;
+        auto mover = world.CreateEntity();
+        auto still = world.CreateEntity();
+        world.AddComponent<TestPosition>(mover);
+        world.AddComponent<TestVelocity>(mover);
+        world.AddComponent<TestPosition>(still);
+        world.AddComponent<TestHealth>(still);
+
+        const ECS::Signature movable = ECS::MakeSignature<TestPosition, TestVelocity>();
+        int matches = 0;
+        world.EachEntity(movable, [&](ECS::EntityID entity) {
+            if (entity == mover) {
+                ++matches;
+            }
+            world.DestroyEntity(entity);
+        });
+
+        bool signaturesOk = matches == 1 && !world.IsEntityAlive(mover) && world.Matches(still, ECS::MakeSignature<TestHealth>())
+            && world.GetSignature(still) == ECS::MakeSignature<TestPosition, TestHealth>()
+            && world.GetSignature(mover).none() && !world.HasComponent<TestPosition>(mover);
+
+        world.RemoveComponent<TestHealth>(still);
+        signaturesOk = signaturesOk && !world.HasComponent<TestHealth>(still) && world.HasComponent<TestPosition>(still);
+
+        if (!signaturesOk) {
+            std::cout << "FAIL: Component signatures" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Component signatures" << std::endl;
+        }
+    }
+
+    // Test 13: Components carry no vtable and stay trivially copyable
+    {
+        static_assert(ECS::IS_TRIVIAL_COMPONENT<TestPosition>, "TestPosition should be trivially copyable");
+        static_assert(sizeof(TestPosition) == 2 * sizeof(float), "Component base must not add storage");
+
+        ECS::World world;
+        auto entity = world.CreateEntity();
+        world.AddComponent<TestPosition>(entity, 1.0f, 2.0f);
+        const ECS::ComponentTypeID positionID = TestPosition::GetStaticTypeID();
+        bool typesOk = positionID != 0 && positionID < ECS::MAX_COMPONENT_TYPES
+            && positionID != TestVelocity::GetStaticTypeID()
+            && positionID == ECS::ComponentTypeRegistry::GetTypeID<TestPosition>()
+            && world.GetComponent<TestPosition>(entity)->GetTypeID() == positionID;
+
+        if (!typesOk) {
+            std::cout << "FAIL: Vtable-free components" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Vtable-free components" << std::endl;
+        }
+    }
+
+    // Test 14: Deferred command buffer
+    {
+        class KillSystem : public ECS::System {
+        public:
+            KillSystem() : ECS::System("KillSystem", 0) {}
+            void Update(ECS::World& world, float) override {
+                auto& commands = world.GetCommandBuffer();
+                for (auto& [entity, health] : *world.GetAllComponents<TestHealth>()) {
+                    if (health->hp <= 0) {
+                        commands.DestroyEntity(entity);
+                        commands.DestroyEntity(entity); // duplicates are harmless
+                    }
+                }
+            }
+        };
+
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 10; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestHealth>(entity, i % 2 == 0 ? 0 : 10);
+            entities.push_back(entity);
+        }
+
+        auto& commands = world.GetCommandBuffer();
+        commands.AddComponent<TestPosition>(entities[1], 3.0f, 4.0f);
+        commands.RemoveComponent<TestHealth>(entities[3]);
+        ECS::EntityID created = ECS::INVALID_ENTITY;
+        commands.CreateEntity([&created](ECS::World& w, ECS::EntityID entity) {
+            w.AddComponent<TestVelocity>(entity, 1.0f, 1.0f);
+            created = entity;
+        });
+        bool commandsOk = commands.Size() == 3 && !world.HasComponent<TestPosition>(entities[1]);
+
+        // Commands recorded on another thread land in that thread's buffer
+        std::thread worker([&world, &entities]() {
+            world.GetCommandBuffer().AddComponent<TestVelocity>(entities[5], 2.0f, 0.0f);
+        });
+        worker.join();
+        commandsOk = commandsOk && commands.Size() == 3;
+
+        world.FlushCommands();
+        commandsOk = commandsOk && commands.Empty()
+            && world.GetComponent<TestPosition>(entities[1]) && world.GetComponent<TestPosition>(entities[1])->y == 4.0f
+            && !world.HasComponent<TestHealth>(entities[3]) && world.HasComponent<TestVelocity>(created)
+            && world.HasComponent<TestVelocity>(entities[5]);
+
+        // The SystemManager plays back after each system
+        world.RegisterSystem<KillSystem>();
+        world.UpdateSystems(0.016f);
+        int alive = 0;
+        for (auto entity : entities) {
+            alive += world.IsEntityAlive(entity) ? 1 : 0;
+        }
+        commandsOk = commandsOk && alive == 5 && world.GetAliveEntityCount() == 6;
+
+        // Callbacks live inline in the buffer: large and non-trivial captures, across blocks
+        ECS::CommandBuffer buffer;
+        auto tracker = std::make_shared<int>(0);
+        std::array<int, 2000> large{};
+        large.back() = 7;
+        int sum = 0;
+        for (int i = 0; i < 100; ++i) {
+            buffer.Defer(entities[1], [tracker, name = std::string(40, 'x'), &sum](ECS::World&, ECS::EntityID) {
+                sum += static_cast<int>(name.size());
+            });
+        }
+        buffer.Defer(entities[1], [large, &sum, &buffer, tracker](ECS::World&, ECS::EntityID entity) {
+            sum += large.back();
+            buffer.Defer(entity, [&sum](ECS::World&, ECS::EntityID) { sum += 1; });
+        });
+        commandsOk = commandsOk && buffer.Size() == 101 && tracker.use_count() == 102;
+        buffer.Playback(world);
+        commandsOk = commandsOk && sum == 100 * 40 + 7 + 1 && buffer.Empty() && tracker.use_count() == 1;
+
+        // Dropped commands still release their captures
+        buffer.Defer(entities[1], [tracker](ECS::World&, ECS::EntityID) {});
+        buffer.Clear();
+        commandsOk = commandsOk && buffer.Empty() && tracker.use_count() == 1;
+
+        if (!commandsOk) {
+            std::cout << "FAIL: Deferred command buffer" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Deferred command buffer" << std::endl;
+        }
+    }
+
+    // Test 15: Parallel scheduling from declared component access
+    {
+        struct Trace {
+            std::atomic<int> running{0};
+            std::atomic<int> maxRunning{0};
+            std::atomic<int> step{0};
+            int positionDone = -1;
+            int readerStart = -1;
+        };
+
+        class TracedSystem : public ECS::System {
+        protected:
+            Trace& m_trace;
+
+            void Enter() {
+                int now = ++m_trace.running;
+                int seen = m_trace.maxRunning.load();
+                while (now > seen && !m_trace.maxRunning.compare_exchange_weak(seen, now)) {}
+                // Give a concurrent stage-mate the chance to start
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+                while (m_trace.maxRunning.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+            }
+
+        public:
+            TracedSystem(const std::string& name, int priority, Trace& trace) : ECS::System(name, priority), m_trace(trace) {}
+        };
+
+        class PositionWriter : public TracedSystem {
+        public:
+            explicit PositionWriter(Trace& trace) : TracedSystem("PositionWriter", 0, trace) {
+                DeclareWrite<TestPosition>();
+            }
+            void Update(ECS::World& world, float) override {
+                Enter();
+                for (auto& [entity, position] : *world.GetAllComponents<TestPosition>()) {
+                    position->x += 1.0f;
+                }
+                world.GetCommandBuffer().CreateEntity([](ECS::World& w, ECS::EntityID entity) {
+                    w.AddComponent<TestHealth>(entity, 7);
+                });
+                --m_trace.running;
+                m_trace.positionDone = m_trace.step++;
+            }
+        };
+
+        class VelocityWriter : public TracedSystem {
+        public:
+            explicit VelocityWriter(Trace& trace) : TracedSystem("VelocityWriter", 1, trace) {
+                DeclareWrite<TestVelocity>();
+            }
+            void Update(ECS::World& world, float) override {
+                Enter();
+                for (auto& [entity, velocity] : *world.GetAllComponents<TestVelocity>()) {
+                    velocity->vx += 1.0f;
+                }
+                --m_trace.running;
+                m_trace.step++;
+            }
+        };
+
+        class PositionReader : public TracedSystem {
+        public:
+            explicit PositionReader(Trace& trace) : TracedSystem("PositionReader", 2, trace) {
+                DeclareRead<TestPosition>();
+            }
+            void Update(ECS::World&, float) override {
+                m_trace.readerStart = m_trace.step++;
+            }
+        };
+
+        Trace trace;
+        ECS::World world;
+        world.SetWorkerCount(2);
+        for (int i = 0; i < 100; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestPosition>(entity, 0.0f, 0.0f);
+            world.AddComponent<TestVelocity>(entity, 0.0f, 0.0f);
+        }
+        world.RegisterSystem<PositionWriter>(trace);
+        world.RegisterSystem<VelocityWriter>(trace);
+        world.RegisterSystem<PositionReader>(trace);
+
+        world.UpdateSystems(0.016f);
+
+        bool valuesOk = true;
+        for (auto& [entity, position] : *world.GetAllComponents<TestPosition>()) {
+            valuesOk = valuesOk && position->x == 1.0f && world.GetComponent<TestVelocity>(entity)->vx == 1.0f;
+        }
+        auto* healths = world.GetAllComponents<TestHealth>();
+        bool parallelOk = valuesOk && trace.maxRunning.load() == 2
+            && trace.readerStart > trace.positionDone
+            && healths->Size() == 1 && healths->begin()->second->hp == 7;
+
+        // Without workers the same frame runs serially with the same outcome
+        world.SetWorkerCount(0);
+        trace.maxRunning = 0;
+        world.UpdateSystems(0.016f);
+        parallelOk = parallelOk && trace.maxRunning.load() == 1 && healths->Size() == 2;
+
+        if (!parallelOk) {
+            std::cout << "FAIL: Parallel system scheduling" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Parallel system scheduling" << std::endl;
+        }
+    }
+
+    // Test 16: parallel_each visits every entity once, plus a 1..N core scaling benchmark (informational)
+    {
+        constexpr int ENTITY_COUNT = 50000;
+        constexpr int ITERATIONS = 20;
+
+        ECS::World world;
+        for (int i = 0; i < ENTITY_COUNT; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+            if (i % 2 == 0) {
+                world.AddComponent<TestVelocity>(entity, 1.0f, 0.0f);
+            }
+            world.AddComponent<TestHealth>(entity, 0);
+        }
+        world.SetWorkerCount(3);
+
+        // Component array, view and group flavours, with small grains to force many chunks
+        world.ParallelEach<TestHealth>([](TestHealth& health) { health.hp += 1; }, 64);
+        world.ParallelEach(world.View<TestPosition, TestVelocity>(), [](TestPosition& pos, TestVelocity& vel) {
+            pos.y += vel.vx;
+        }, 100);
+        world.ParallelEach(world.Group<TestPosition, TestVelocity>(), [](ECS::EntityID, TestPosition& pos, TestVelocity&) {
+            pos.y += 1.0f;
+        }, 1000);
+
+        bool eachOk = true;
+        for (auto [entity, pos, health] : world.View<TestPosition, TestHealth>()) {
+            const bool moving = world.HasComponent<TestVelocity>(entity);
+            eachOk = eachOk && health.hp == 1 && pos.y == (moving ? 2.0f : 0.0f);
+        }
+
+        // Structural changes from chunks go through each thread's own command buffer
+        world.ParallelEach<TestHealth>([&world](ECS::EntityID entity, TestHealth&) {
+            if (ECS::GetEntityIndex(entity) % 5 == 0) {
+                world.GetCommandBuffer().DestroyEntity(entity);
+            }
+        }, 128);
+        world.FlushCommands();
+        eachOk = eachOk && world.GetAliveEntityCount() == ENTITY_COUNT - ENTITY_COUNT / 5;
+
+        // Exceptions thrown by a chunk reach the caller
+        bool rethrown = false;
+        try {
+            world.ParallelEach<TestHealth>([](TestHealth& health) {
+                if (health.hp == 1) {
+                    throw std::runtime_error("chunk failure");
+                }
+            }, 64);
+        } catch (const std::runtime_error&) {
+            rethrown = true;
+        }
+        eachOk = eachOk && rethrown;
+
+        // Scaling: the same work with 0 (caller only) to hardware_concurrency() - 1 workers
+        auto work = [](TestPosition& pos) {
+            float value = pos.x;
+            for (int k = 0; k < 64; ++k) {
+                value = value * 0.5f + 1.0f;
+            }
+            pos.y = value;
+        };
+        const std::size_t maxWorkers = std::max<std::size_t>(ECS::ThreadPool::DefaultWorkerCount(), 1);
+        std::cout << "INFO: parallel_each over " << world.GetAllComponents<TestPosition>()->Size()
+                  << " entities x " << ITERATIONS << " passes:";
+        for (std::size_t workers = 0; workers <= maxWorkers; workers = workers == 0 ? 1 : workers * 2) {
+            world.SetWorkerCount(workers);
+            world.GetThreadPool();
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                world.ParallelEach<TestPosition>(work);
+            }
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            std::cout << " " << workers + 1 << " core(s) " << elapsed.count() << "us;";
+        }
+        std::cout << std::endl;
+
+        if (!eachOk) {
+            std::cout << "FAIL: Parallel each" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Parallel each" << std::endl;
+        }
+    }
+
+    // Test 17: Slab storage keeps addresses on growth and reuses memory across spawn waves
+    {
+        struct Pinned {
+            int value;
+            std::mutex lock; // neither movable nor copyable: boxed in a slab pool
+            explicit Pinned(int v = 0) : value(v) {}
+        };
+
+        ECS::World world;
+        auto first = world.CreateEntity();
+        TestPosition* firstPos = world.AddComponent<TestPosition>(first, 42.0f, 24.0f);
+        Pinned* firstPinned = world.AddComponent<Pinned>(first, 7);
+
+        // Growth appends slabs instead of relocating
+        std::vector<ECS::EntityID> wave;
+        for (int i = 0; i < 5000; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+            world.AddComponent<Pinned>(entity, i);
+            wave.push_back(entity);
+        }
+        bool slabOk = world.GetComponent<TestPosition>(first) == firstPos && firstPos->x == 42.0f
+            && world.GetComponent<Pinned>(first) == firstPinned && firstPinned->value == 7;
+
+        // Destroy/create cycles reuse the slabs
+        auto* positions = world.GetAllComponents<TestPosition>();
+        const std::size_t capacity = positions->Capacity();
+        for (int cycle = 0; cycle < 3; ++cycle) {
+            for (auto entity : wave) {
+                world.DestroyEntity(entity);
+            }
+            wave.clear();
+            for (int i = 0; i < 5000; ++i) {
+                auto entity = world.CreateEntity();
+                world.AddComponent<TestPosition>(entity, 1.0f, static_cast<float>(cycle));
+                world.AddComponent<Pinned>(entity, cycle);
+                wave.push_back(entity);
+            }
+        }
+        slabOk = slabOk && positions->Capacity() == capacity && positions->Size() == 5001
+            && world.GetComponent<Pinned>(wave.back())->value == 2
+            && world.GetComponent<Pinned>(first) == firstPinned;
+
+        // Reserve makes room up front
+        auto* healths = world.GetAllComponents<TestHealth>();
+        healths->Reserve(3000);
+        const std::size_t reserved = healths->Capacity();
+        for (int i = 0; i < 3000; ++i) {
+            world.AddComponent<TestHealth>(wave[i], i);
+        }
+        slabOk = slabOk && reserved >= 3000 && healths->Capacity() == reserved;
+
+        if (!slabOk) {
+            std::cout << "FAIL: Slab component storage" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Slab component storage" << std::endl;
+        }
+    }
+
+    // Test 18: Change tracking with per-component version stamps
+    {
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 10; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+            world.AddComponent<TestVelocity>(entity, 0.0f, 0.0f);
+            entities.push_back(entity);
+        }
+
+        auto countChanged = [&world](ECS::Tick since) {
+            int count = 0;
+            world.EachChanged<TestPosition>(since, [&count](ECS::EntityID, TestPosition&) { ++count; });
+            return count;
+        };
+
+        // Untracked types report everything as changed
+        bool trackingOk = countChanged(world.GetTick() + 100) == 10;
+
+        world.EnableChangeTracking<TestPosition>();
+        ECS::Tick since = world.AdvanceTick();
+        trackingOk = trackingOk && countChanged(since) == 0;
+
+        // Modify, MarkChanged and (re)adding stamp; plain GetComponent does not
+        world.ModifyComponent<TestPosition>(entities[2])->x = 100.0f;
+        world.GetComponent<TestPosition>(entities[3])->x = 200.0f;
+        world.GetComponent<TestPosition>(entities[4])->x = 300.0f;
+        world.MarkChanged<TestPosition>(entities[4]);
+        world.AddComponent<TestPosition>(entities[5], 5.0f, 5.0f);
+        std::vector<ECS::EntityID> changed;
+        world.EachChanged<TestPosition>(since, [&changed](ECS::EntityID entity, TestPosition&) { changed.push_back(entity); });
+        trackingOk = trackingOk && changed.size() == 3
+            && std::find(changed.begin(), changed.end(), entities[2]) != changed.end()
+            && std::find(changed.begin(), changed.end(), entities[4]) != changed.end()
+            && std::find(changed.begin(), changed.end(), entities[5]) != changed.end();
+
+        // Versions follow their component through swap-and-pop and group reordering
+        const ECS::Tick stamp = world.GetAllComponents<TestPosition>()->GetVersion(entities[9]);
+        since = world.AdvanceTick();
+        world.DestroyEntity(entities[0]);
+        world.Group<TestPosition, TestVelocity>();
+        world.RemoveComponent<TestVelocity>(entities[1]);
+        trackingOk = trackingOk && countChanged(since) == 0
+            && world.GetAllComponents<TestPosition>()->GetVersion(entities[9]) == stamp
+            && world.GetAllComponents<TestPosition>()->GetVersion(entities[2]) < since;
+
+        // A newly created entity counts as changed for the next consumer pass
+        auto spawned = world.CreateEntity();
+        world.AddComponent<TestPosition>(spawned);
+        trackingOk = trackingOk && countChanged(since) == 1 && world.GetAllComponents<TestPosition>()->GetVersion(spawned) == since;
+
+        if (!trackingOk) {
+            std::cout << "FAIL: Component change tracking" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Component change tracking" << std::endl;
+        }
+    }
+
+    // Test 19: Component signals, immediate and queued
+    {
+        // Reactive system: counts live healths from events instead of walking the pool
+        class HealthCounter : public ECS::System {
+        public:
+            int alive = 0;
+            int runs = 0;
+            bool readableOnDestroy = true;
+            ECS::ConnectionID added = 0;
+            ECS::ConnectionID removed = 0;
+
+            HealthCounter() : ECS::System("HealthCounter", 0) {}
+            void Initialize(ECS::World& world) override {
+                added = world.OnConstruct<TestHealth>().Connect([this](ECS::EntityID) { ++alive; }, ECS::Dispatch::Queued);
+                removed = world.OnDestroy<TestHealth>().Connect([this, &world](ECS::EntityID entity) {
+                    readableOnDestroy = readableOnDestroy && world.GetComponent<TestHealth>(entity) != nullptr;
+                    --alive;
+                });
+            }
+            void Cleanup(ECS::World& world) override {
+                world.OnConstruct<TestHealth>().Disconnect(added);
+                world.OnDestroy<TestHealth>().Disconnect(removed);
+            }
+            void Update(ECS::World&, float) override { ++runs; }
+        };
+
+        ECS::World world;
+        auto* counter = world.RegisterSystem<HealthCounter>();
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 5; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestHealth>(entity, 10);
+            entities.push_back(entity);
+        }
+
+        // Queued events wait for the next sync point
+        bool signalsOk = counter->alive == 0;
+        world.UpdateSystems(0.016f);
+        signalsOk = signalsOk && counter->alive == 5;
+
+        // Immediate listeners see the component before it goes away
+        world.RemoveComponent<TestHealth>(entities[0]);
+        world.DestroyEntity(entities[1]);
+        world.RemoveComponent<TestHealth>(entities[0]); // absent: no event
+        signalsOk = signalsOk && counter->alive == 3 && counter->readableOnDestroy;
+
+        // Replacing or modifying fires OnUpdate only
+        int updates = 0;
+        auto onUpdate = world.OnUpdate<TestHealth>().Connect([&updates](ECS::EntityID) { ++updates; });
+        world.AddComponent<TestHealth>(entities[2], 50);
+        world.ModifyComponent<TestHealth>(entities[3])->hp = 5;
+        world.MarkChanged<TestHealth>(entities[4]);
+        world.ModifyComponent<TestHealth>(entities[0]); // absent: no event
+        world.GetComponent<TestHealth>(entities[4])->hp = 1; // plain write: no event
+        world.DispatchQueuedEvents();
+        signalsOk = signalsOk && updates == 3 && counter->alive == 3;
+
+        // Disconnected listeners are no longer called
+        signalsOk = signalsOk && world.OnUpdate<TestHealth>().Disconnect(onUpdate)
+            && !world.OnUpdate<TestHealth>().Disconnect(onUpdate);
+        world.MarkChanged<TestHealth>(entities[4]);
+        signalsOk = signalsOk && updates == 3;
+
+        // Queued events raised from worker threads are all delivered
+        world.OnUpdate<TestHealth>().Connect([&updates](ECS::EntityID) { ++updates; }, ECS::Dispatch::Queued);
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; ++t) {
+            writers.emplace_back([&world, &entities, t]() {
+                for (int i = 0; i < 100; ++i) {
+                    world.MarkChanged<TestHealth>(entities[2 + t % 3]);
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        signalsOk = signalsOk && updates == 3;
+        world.DispatchQueuedEvents();
+        signalsOk = signalsOk && updates == 403;
+
+        world.RemoveSystem("HealthCounter");
+        signalsOk = signalsOk && world.OnConstruct<TestHealth>().Empty() && world.OnDestroy<TestHealth>().Empty();
+
+        if (!signalsOk) {
+            std::cout << "FAIL: Component signals" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Component signals" << std::endl;
+        }
+    }
+
+    // Test 20: Secondary index maintained across add, remove and mutation
+    {
+        struct ByHp {
+            int operator()(const TestHealth& health) const { return health.hp; }
+        };
+
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 6; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestHealth>(entity, i % 3);
+            entities.push_back(entity);
+        }
+
+        // Buckets are unordered
+        auto& index = world.Index<TestHealth, ByHp>();
+        auto holds = [&index](int key, std::vector<ECS::EntityID> expected) {
+            std::vector<ECS::EntityID> found = index.Find(key);
+            std::sort(found.begin(), found.end());
+            std::sort(expected.begin(), expected.end());
+            return found == expected;
+        };
+
+        // Built from the existing components on first use, then same instance
+        bool indexOk = &index == &world.Index<TestHealth, ByHp>()
+            && index.Count(0) == 2 && index.Count(1) == 2 && index.Count(2) == 2 && !index.Contains(3)
+            && holds(1, {entities[1], entities[4]})
+            && index.FindFirst(3) == ECS::INVALID_ENTITY;
+
+        // Add and remove
+        auto spawned = world.CreateEntity();
+        world.AddComponent<TestHealth>(spawned, 1);
+        world.RemoveComponent<TestHealth>(entities[1]);
+        world.DestroyEntity(entities[2]);
+        indexOk = indexOk && holds(1, {entities[4], spawned}) && index.Count(2) == 1;
+
+        // Mutation through ModifyComponent/MarkChanged and replacement re-keys; plain writes do not
+        world.ModifyComponent<TestHealth>(entities[0])->hp = 7;
+        world.GetComponent<TestHealth>(entities[3])->hp = 7;
+        world.MarkChanged<TestHealth>(entities[3]);
+        world.AddComponent<TestHealth>(entities[5], 7);
+        world.GetComponent<TestHealth>(entities[4])->hp = 9;
+        indexOk = indexOk && index.Count(7) == 3 && index.Count(0) == 0 && index.Count(2) == 0
+            && index.Count(9) == 0 && holds(1, {entities[4], spawned});
+
+        // Stale entries destroyed before the next lookup are dropped
+        world.MarkChanged<TestHealth>(spawned);
+        world.DestroyEntity(spawned);
+        indexOk = indexOk && index.Find(1) == std::vector<ECS::EntityID>{entities[4]};
+
+        // Removing from the middle of a bucket keeps every other entry reachable
+        std::vector<ECS::EntityID> bucket;
+        for (int i = 0; i < 5; ++i) {
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestHealth>(entity, 4);
+            bucket.push_back(entity);
+        }
+        world.DestroyEntity(bucket[1]);
+        world.ModifyComponent<TestHealth>(bucket[3])->hp = 5;
+        world.DestroyEntity(bucket[0]);
+        indexOk = indexOk && holds(4, {bucket[2], bucket[4]}) && index.FindFirst(5) == bucket[3];
+        world.DestroyEntity(bucket[4]);
+        world.DestroyEntity(bucket[2]);
+        indexOk = indexOk && !index.Contains(4) && index.Count(5) == 1;
+
+        world.Clear();
+        indexOk = indexOk && index.Count(7) == 0 && index.Count(1) == 0;
+
+        if (!indexOk) {
+            std::cout << "FAIL: Secondary component index" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Secondary component index" << std::endl;
+        }
+    }
+
+    // Test 21: Binary world snapshot and restore
+    {
+        struct Tag : public ECS::Component<Tag> {
+            std::string name;   // not trivially copyable: left out of snapshots
+            explicit Tag(std::string name = "") : name(std::move(name)) {}
+        };
+
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 600; ++i) {   // spans several slabs
+            auto entity = world.CreateEntity();
+            world.AddComponent<TestPosition>(entity, static_cast<float>(i), 1.0f);
+            if (i % 2 == 0) {
+                world.AddComponent<TestHealth>(entity, i);
+            }
+            world.AddComponent<Tag>(entity, "e");
+            entities.push_back(entity);
+        }
+
+        // Rollback: values rewound, gained components dropped, destroyed entities recreated
+        ECS::WorldSnapshot before = world.Snapshot();
+        bool snapshotOk = !before.Empty() && before.GetEntities().size() == 600;
+        world.GetComponent<TestPosition>(entities[10])->x = -1.0f;
+        world.RemoveComponent<TestHealth>(entities[20]);
+        world.AddComponent<TestVelocity>(entities[30], 1.0f, 1.0f);
+        world.AddComponent<TestHealth>(entities[31], 5);
+        world.DestroyEntity(entities[40]);
+        std::vector<ECS::EntityID> restored = world.Restore(before);
+        snapshotOk = snapshotOk && restored.size() == 600 && restored[10] == entities[10]
+            && world.GetComponent<TestPosition>(entities[10])->x == 10.0f
+            && world.GetComponent<TestHealth>(entities[20]) && world.GetComponent<TestHealth>(entities[20])->hp == 20
+            && !world.HasComponent<TestVelocity>(entities[30]) && !world.HasComponent<TestHealth>(entities[31])
+            && world.HasComponent<Tag>(entities[30])
+            && restored[40] != entities[40] && world.GetComponent<TestPosition>(restored[40])->x == 40.0f
+            && world.GetComponent<TestHealth>(restored[40])->hp == 40 && !world.HasComponent<Tag>(restored[40]);
+
+        // Filtered snapshot cloned into the same world, then into a fresh world
+        ECS::WorldSnapshot evens = world.Snapshot([&world](ECS::EntityID e) {
+            auto* health = world.GetComponent<TestHealth>(e);
+            return health && health->hp < 10;
+        });
+        const std::size_t before_count = world.GetAliveEntityCount();
+        std::vector<ECS::EntityID> clones = world.Restore(evens, ECS::RestoreMode::Clone);
+        snapshotOk = snapshotOk && clones.size() == 5 && world.GetAliveEntityCount() == before_count + 5
+            && world.GetComponent<TestHealth>(clones[2]) && world.GetComponent<TestHealth>(clones[2])->hp % 2 == 0
+            && world.GetAllComponents<TestHealth>()->Size() == 305;
+
+        ECS::World other;
+        auto fixture = other.Restore(ECS::WorldSnapshot(before.GetData()));
+        snapshotOk = snapshotOk && other.GetAliveEntityCount() == 600
+            && other.GetComponent<TestPosition>(fixture[599])->x == 599.0f
+            && !other.HasComponent<TestHealth>(fixture[599]) && other.HasComponent<TestHealth>(fixture[598]);
+
+        // Blocks name their type by hash, resolved to this process's registration-order type ID
+        snapshotOk = snapshotOk
+            && ECS::ComponentManager::FindTypeID(ECS::TypeNameHash<TestHealth>()) == TestHealth::GetStaticTypeID()
+            && ECS::ComponentManager::FindTypeID(0) == ECS::MAX_COMPONENT_TYPES;
+
+        // Malformed buffers are rejected without touching the world
+        bool rejected = false;
+        std::vector<unsigned char> truncated = before.GetData();
+        truncated.resize(truncated.size() - 3);
+        try {
+            other.Restore(ECS::WorldSnapshot(truncated));
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        snapshotOk = snapshotOk && rejected && other.GetAliveEntityCount() == 600;
+
+        if (!snapshotOk) {
+            std::cout << "FAIL: World snapshot and restore" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: World snapshot and restore" << std::endl;
+        }
+    }
+
+    // Test 22: Entity hierarchy with cascading destroy
+    {
+        ECS::World world;
+        auto room = world.CreateEntity();
+        auto enemyA = world.CreateEntity();
+        auto enemyB = world.CreateEntity();
+        auto player = world.CreateEntity();
+        auto bullet = world.CreateEntity();
+        world.AddComponent<TestHealth>(enemyA, 10);
+
+        bool hierarchyOk = world.SetParent(enemyA, room, true) && world.SetParent(enemyB, room, true)
+            && world.SetParent(player, room) && world.SetParent(bullet, enemyA, true);
+        hierarchyOk = hierarchyOk && world.GetParent(enemyA) == room && world.GetParent(room) == ECS::INVALID_ENTITY
+            && world.GetChildren(room) == std::vector<ECS::EntityID>{enemyA, enemyB, player}
+            && world.GetChildCount(enemyA) == 1;
+
+        // Cycles and self-parenting are rejected
+        hierarchyOk = hierarchyOk && !world.SetParent(room, bullet) && !world.SetParent(room, room)
+            && world.GetParent(room) == ECS::INVALID_ENTITY;
+
+        // Reparenting moves the child between lists
+        hierarchyOk = hierarchyOk && world.SetParent(enemyB, enemyA, true)
+            && world.GetChildren(room) == std::vector<ECS::EntityID>{enemyA, player}
+            && world.GetChildren(enemyA) == std::vector<ECS::EntityID>{bullet, enemyB};
+        world.RemoveParent(enemyB);
+        hierarchyOk = hierarchyOk && world.GetParent(enemyB) == ECS::INVALID_ENTITY && world.GetChildCount(enemyA) == 1;
+        world.SetParent(enemyB, room, true);
+
+        // Destroying the room cascades recursively and detaches the others
+        world.DestroyEntity(room);
+        hierarchyOk = hierarchyOk && !world.IsEntityAlive(enemyA) && !world.IsEntityAlive(enemyB)
+            && !world.IsEntityAlive(bullet) && world.IsEntityAlive(player)
+            && world.GetParent(player) == ECS::INVALID_ENTITY
+            && world.GetAllComponents<TestHealth>()->Size() == 0;
+
+        // Recycled slots start without links
+        auto fresh = world.CreateEntity();
+        hierarchyOk = hierarchyOk && world.GetParent(fresh) == ECS::INVALID_ENTITY && world.GetChildCount(fresh) == 0;
+
+        world.SetParent(fresh, player);
+        world.Clear();
+        auto afterClear = world.CreateEntity();
+        hierarchyOk = hierarchyOk && world.GetParent(afterClear) == ECS::INVALID_ENTITY;
+
+        if (!hierarchyOk) {
+            std::cout << "FAIL: Entity hierarchy" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Entity hierarchy" << std::endl;
+        }
+    }
+
+    // Test 23: Tag components as bitsets and categorical partitions
+    {
+        struct Frozen {};
+        enum class Side : std::uint8_t { Neutral, Ally, Foe };
+        struct Faction : public ECS::Component<Faction> {
+            Side side;
+            explicit Faction(Side side = Side::Neutral) : side(side) {}
+        };
+        struct BySide { Side operator()(const Faction& faction) const { return faction.side; } };
+
+        ECS::World world;
+        std::vector<ECS::EntityID> entities;
+        for (int i = 0; i < 200; ++i) {   // spans several bitset words
+            auto entity = world.CreateEntity();
+            world.AddComponent<Faction>(entity, i % 4 == 0 ? Side::Foe : Side::Ally);
+            if (i % 3 == 0) {
+                world.AddTag<Frozen>(entity);
+            }
+            entities.push_back(entity);
+        }
+
+        // Tags: membership, iteration, removal, cleanup on destroy
+        int untagged = 0;
+        world.OnDestroy<Frozen>().Connect([&untagged](ECS::EntityID) { ++untagged; });
+        std::size_t visited = 0;
+        world.EachTagged<Frozen>([&](ECS::EntityID entity) { visited += world.HasTag<Frozen>(entity) ? 1 : 0; });
+        bool tagsOk = world.GetTagCount<Frozen>() == 67 && visited == 67
+            && world.HasTag<Frozen>(entities[3]) && !world.HasTag<Frozen>(entities[4])
+            && world.GetAllComponents<Faction>()->Size() == 200;
+        world.RemoveTag<Frozen>(entities[3]);
+        world.DestroyEntity(entities[6]);
+        tagsOk = tagsOk && !world.HasTag<Frozen>(entities[3]) && world.GetTagCount<Frozen>() == 65 && untagged == 2;
+        auto reused = world.CreateEntity();
+        tagsOk = tagsOk && !world.HasTag<Frozen>(reused);
+
+        // Partitions: one bitset per category
+        auto& sides = world.Partition<Faction, BySide>();
+        std::size_t foes = 0;
+        sides.Each(Side::Foe, [&](ECS::EntityID entity) { foes += world.GetComponent<Faction>(entity)->side == Side::Foe ? 1 : 0; });
+        bool partitionOk = foes == 50 && sides.Count(Side::Foe) == 50 && sides.Count(Side::Ally) == 149
+            && sides.Count(Side::Neutral) == 0 && sides.Contains(entities[8], Side::Foe);
+
+        // Updates re-file the entity, replacements and removals too
+        world.ModifyComponent<Faction>(entities[8])->side = Side::Ally;
+        world.AddComponent<Faction>(entities[9], Side::Foe);
+        world.RemoveComponent<Faction>(entities[12]);
+        world.DispatchQueuedEvents();
+        partitionOk = partitionOk && sides.Count(Side::Foe) == 49 && sides.Contains(entities[8], Side::Ally)
+            && sides.Contains(entities[9], Side::Foe) && !sides.Contains(entities[12], Side::Foe);
+
+        // The visitor may destroy entities of the category being scanned
+        sides.Each(Side::Foe, [&](ECS::EntityID entity) { world.DestroyEntity(entity); });
+        partitionOk = partitionOk && sides.Count(Side::Foe) == 0 && sides.Count(Side::Ally) == 149
+            && world.GetAllComponents<Faction>()->Size() == 149;
+
+        world.Clear();
+        partitionOk = partitionOk && sides.Count(Side::Ally) == 0 && world.GetTagCount<Frozen>() == 0;
+
+        if (!tagsOk || !partitionOk) {
+            std::cout << "FAIL: Tags and partitions" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Tags and partitions" << std::endl;
+        }
+    }
+
+    // Test 24: Prefabs instantiate batches of entities
+    {
+        struct Hostile {};
+        ECS::World world;
+        auto& moving = world.Group<>(ECS::With<TestPosition, TestVelocity>{});
+        int constructed = 0;
+        world.OnConstruct<TestHealth>().Connect([&constructed](ECS::EntityID) { ++constructed; });
+
+        const ECS::Prefab pellet = ECS::Prefab("Pellet")
+            .With<TestPosition>(1.0f, 2.0f)
+            .With<TestVelocity>(3.0f, 0.0f)
+            .With<TestHealth>(5)
+            .With<TestHealth>(7)   // replaces the previous prototype
+            .With<Hostile>();
+
+        std::vector<ECS::EntityID> batch = world.Instantiate(pellet, 5, [&](ECS::EntityID entity, std::size_t i) {
+            world.GetComponent<TestVelocity>(entity)->vy = static_cast<float>(i);
+        });
+        bool prefabOk = pellet.GetName() == "Pellet" && batch.size() == 5 && world.GetAliveEntityCount() == 5
+            && pellet.GetSignature() == ECS::MakeSignature<TestPosition, TestVelocity, TestHealth, Hostile>()
+            && moving.Size() == 5 && constructed == 5 && world.GetTagCount<Hostile>() == 5;
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            prefabOk = prefabOk && world.IsEntityAlive(batch[i])
+                && world.GetComponent<TestPosition>(batch[i])->y == 2.0f
+                && world.GetComponent<TestVelocity>(batch[i])->vy == static_cast<float>(i)
+                && world.GetComponent<TestHealth>(batch[i])->hp == 7;
+        }
+
+        // Instances are independent copies; single instantiation reuses freed slots
+        world.GetComponent<TestPosition>(batch[0])->x = 42.0f;
+        world.DestroyEntity(batch[1]);
+        auto single = world.Instantiate(pellet).front();
+        prefabOk = prefabOk && world.GetComponent<TestPosition>(batch[2])->x == 1.0f
+            && world.GetComponent<TestPosition>(single)->x == 1.0f && world.HasTag<Hostile>(single)
+            && ECS::GetEntityIndex(single) == ECS::GetEntityIndex(batch[1]) && world.GetAliveEntityCount() == 5;
+        prefabOk = prefabOk && world.Instantiate(pellet, 0).empty();
+
+        if (!prefabOk) {
+            std::cout << "FAIL: Prefab instantiation" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Prefab instantiation" << std::endl;
+        }
+    }
+
+    // Test 25: Archetype chunks, plus a chunk vs sparse-set view benchmark (informational)
+    {
+        constexpr int ENTITY_COUNT = 10000;
+        constexpr int ITERATIONS = 200;
+
+        auto populate = [](ECS::World& world) {
+            for (int i = 0; i < ENTITY_COUNT; ++i) {
+                auto entity = world.CreateEntity();
+                world.AddComponent<TestPosition>(entity, static_cast<float>(i), 0.0f);
+                world.AddComponent<TestVelocity>(entity, 1.0f, 0.5f);
+                if (i % 4 != 0) {
+                    world.AddComponent<TestHealth>(entity, i);
+                }
+            }
+        };
+
+        ECS::World sparseWorld;
+        ECS::World archetypeWorld;
+        auto& archetype = archetypeWorld.Archetype<TestPosition, TestVelocity, TestHealth>();
+        populate(sparseWorld);
+        populate(archetypeWorld);
+
+        // Chunks cover every member once, and columns alias the components GetComponent() returns
+        std::size_t visited = 0;
+        std::size_t chunks = 0;
+        bool aliasOk = true;
+        archetype.EachChunk([&](std::size_t count, const ECS::EntityID* entities,
+                                TestPosition* pos, TestVelocity* vel, TestHealth* health) {
+            ++chunks;
+            visited += count;
+            for (std::size_t i = 0; i < count; ++i) {
+                aliasOk = aliasOk && archetypeWorld.GetComponent<TestPosition>(entities[i]) == &pos[i]
+                    && archetypeWorld.GetComponent<TestVelocity>(entities[i]) == &vel[i]
+                    && archetypeWorld.GetComponent<TestHealth>(entities[i]) == &health[i];
+            }
+        });
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            sparseWorld.View<TestPosition, TestVelocity, TestHealth>().Each([](TestPosition& pos, TestVelocity& vel, TestHealth&) {
+                pos.x += vel.vx;
+                pos.y += vel.vy;
+            });
+        }
+        auto sparseTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            archetype.EachChunk([](std::size_t count, const ECS::EntityID*, TestPosition* pos, TestVelocity* vel, TestHealth*) {
+                for (std::size_t j = 0; j < count; ++j) {
+                    pos[j].x += vel[j].vx;
+                    pos[j].y += vel[j].vy;
+                }
+            });
+        }
+        auto chunkTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        float sparseSum = 0.0f;
+        float chunkSum = 0.0f;
+        sparseWorld.View<TestPosition, TestHealth>().Each([&sparseSum](TestPosition& pos, TestHealth&) { sparseSum += pos.y; });
+        archetype.Each([&chunkSum](TestPosition& pos, TestVelocity&, TestHealth&) { chunkSum += pos.y; });
+
+        std::cout << "INFO: " << archetype.Size() << " matches x " << ITERATIONS << " passes: sparse-set view "
+                  << sparseTime.count() << "us, archetype chunks " << chunkTime.count() << "us ("
+                  << chunks << " chunks)" << std::endl;
+
+        // Removing a component moves the entity out of the archetype, GetComponent keeps working
+        const ECS::EntityID first = archetypeWorld.GetAllComponents<TestHealth>()->GetEntityAt(0);
+        archetypeWorld.RemoveComponent<TestHealth>(first);
+        bool leftOk = !archetype.Contains(first) && archetypeWorld.GetComponent<TestPosition>(first) != nullptr;
+
+        const std::size_t expected = ENTITY_COUNT - ENTITY_COUNT / 4;
+        if (visited != expected || chunks < 2 || !aliasOk || sparseSum != chunkSum || !leftOk
+            || archetype.Size() != expected - 1) {
+            std::cout << "FAIL: Archetype chunks" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Archetype chunks" << std::endl;
+        }
+    }
+
+#if ECS_PROFILING
+    // Test 26: Per-system timings, component counts and periodic dumps
+    {
+        class SlowSystem : public ECS::System {
+        public:
+            SlowSystem() : ECS::System("SlowSystem", 1) {}
+            void Update(ECS::World&, float) override {
+                auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+                while (std::chrono::steady_clock::now() < until) {}
+            }
+        };
+        class FastSystem : public ECS::System {
+        public:
+            FastSystem() : ECS::System("FastSystem", 0) {}
+            void Update(ECS::World&, float) override {}
+        };
+
+        ECS::World world;
+        world.SetWorkerCount(0);
+        world.RegisterSystem<SlowSystem>();
+        world.RegisterSystem<FastSystem>();
+        for (int i = 0; i < 3; ++i) {
+            world.AddComponent<TestPosition>(world.CreateEntity(), 0.0f, 0.0f);
+        }
+
+        int dumps = 0;
+        std::uint64_t lastDumpFrame = 0;
+        world.SetProfileDump(4, [&](const ECS::ProfileReport& report) {
+            ++dumps;
+            lastDumpFrame = report.frame;
+        });
+        for (int i = 0; i < 10; ++i) {
+            world.UpdateSystems(0.016f);
+        }
+
+        ECS::ProfileReport report = world.GetProfileReport();
+        bool profileOk = report.frame == 10 && report.tick.samples == 10 && dumps == 2 && lastDumpFrame == 8
+            && report.systems.size() == 2 && report.systems[0].name == "FastSystem"
+            && report.systems[1].name == "SlowSystem" && report.systems[1].stats.samples == 10
+            && report.systems[1].stats.p50 >= 200.0 && report.systems[1].stats.p50 <= report.systems[1].stats.p95
+            && report.systems[1].stats.p95 <= report.systems[1].stats.p99
+            && report.systems[1].stats.p99 <= report.systems[1].stats.max
+            && report.tick.max >= report.systems[1].stats.max;
+
+        bool counted = false;
+        for (const ECS::ComponentCount& component : report.components) {
+            if (component.typeName.find("TestPosition") != std::string::npos) {
+                counted = component.count == 3;
+            }
+        }
+        profileOk = profileOk && counted && ECS::FormatProfileReport(report).find("SlowSystem") != std::string::npos;
+
+        // The window only keeps the last samples
+        ECS::RollingHistogram histogram;
+        for (int i = 1; i <= 300; ++i) {
+            histogram.Record(std::chrono::microseconds(i));
+        }
+        ECS::TimingStats stats = histogram.GetStats();
+        profileOk = profileOk && stats.samples == ECS::RollingHistogram::WINDOW && stats.max == 300.0
+            && stats.p50 == 300.0 - ECS::RollingHistogram::WINDOW / 2 && ECS::RollingHistogram().GetStats().samples == 0;
+
+        if (!profileOk) {
+            std::cout << "FAIL: System profiling" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: System profiling" << std::endl;
+        }
+    }
+#endif
+
+    // Test 27: Fixed-rate systems with phase offsets and a catch-up limit
+    {
+        class RateProbe : public ECS::System {
+        public:
+            int* frame;
+            std::vector<int> frames;
+            std::vector<float> deltas;
+
+            RateProbe(const std::string& name, int* currentFrame, float hz, float phase)
+                : ECS::System(name, 0), frame(currentFrame) {
+                SetUpdateRate(hz, phase);
+            }
+            void Update(ECS::World&, float deltaTime) override {
+                frames.push_back(*frame);
+                deltas.push_back(deltaTime);
+            }
+        };
+
+        ECS::World world;
+        world.SetWorkerCount(0);
+        int frame = 0;
+        auto* onBeat = world.RegisterSystem<RateProbe>("OnBeat", &frame, 4.0f, 0.0f);
+        auto* offBeat = world.RegisterSystem<RateProbe>("OffBeat", &frame, 4.0f, 0.5f);
+        auto* everyFrame = world.RegisterSystem<RateProbe>("EveryFrame", &frame, 0.0f, 0.0f);
+        auto* autoA = world.RegisterSystem<RateProbe>("AutoA", &frame, 1.0f, ECS::System::AUTO_PHASE);
+        auto* autoB = world.RegisterSystem<RateProbe>("AutoB", &frame, 1.0f, ECS::System::AUTO_PHASE);
+
+        // 1 second at 16 frames per second (exact binary fractions)
+        for (frame = 1; frame <= 16; ++frame) {
+            world.UpdateSystems(0.0625f);
+        }
+        bool rateOk = onBeat->frames == std::vector<int>{1, 4, 8, 12, 16}
+            && offBeat->frames == std::vector<int>{2, 6, 10, 14}
+            && everyFrame->frames.size() == 16 && everyFrame->deltas.back() == 0.0625f
+            && std::all_of(onBeat->deltas.begin(), onBeat->deltas.end(), [](float dt) { return dt == 0.25f; })
+            && autoA->GetPhase() >= 0.0f && autoB->GetPhase() >= 0.0f
+            && std::abs(autoA->GetPhase() - autoB->GetPhase()) > 0.25f
+            && !autoA->frames.empty() && !autoB->frames.empty() && autoA->frames.front() != autoB->frames.front();
+
+        // A stall owes 8 periods: only DEFAULT_MAX_STEPS run, the rest is dropped
+        onBeat->frames.clear();
+        world.UpdateSystems(2.0f);
+        rateOk = rateOk && onBeat->frames.size() == ECS::System::DEFAULT_MAX_STEPS;
+        onBeat->frames.clear();
+        world.UpdateSystems(0.0625f);
+        rateOk = rateOk && onBeat->frames.empty();
+
+        // Back to every frame through the world
+        rateOk = rateOk && world.SetSystemRate("OffBeat", 0.0f) && !world.SetSystemRate("Missing", 1.0f);
+        offBeat->frames.clear();
+        world.UpdateSystems(0.01f);
+        world.UpdateSystems(0.01f);
+        rateOk = rateOk && offBeat->frames.size() == 2 && offBeat->deltas.back() == 0.01f;
+
+        if (!rateOk) {
+            std::cout << "FAIL: Fixed-rate systems" << std::endl;
+            allTestsPassed = false;
+        } else {
+            std::cout << "PASS: Fixed-rate systems" << std::endl;
+        }
+    }
+
     if (allTestsPassed) {
         std::cout << "\nAll ECS tests passed!" << std::endl;
         return 0;
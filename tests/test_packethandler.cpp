@@ -38,8 +38,8 @@ void testPlayerJoinCallback(const packet_t& packet) {
     playerJoinCallbackCount++;
 
     // Callback handles casting the packet data
-    if (packet.header.data_size >= sizeof(PlayerJoinPacket) && packet.data) {
-        const PlayerJoinPacket* joinData = static_cast<const PlayerJoinPacket*>(packet.data);
+    if (packet.header.data_size >= sizeof(PlayerJoinPacket) && packet.data()) {
+        const PlayerJoinPacket* joinData = static_cast<const PlayerJoinPacket*>(packet.data());
         std::cout << "PlayerJoin callback triggered - ID: " << joinData->newPlayerId
                   << ", Name: " << joinData->name << std::endl;
     } else {
@@ -51,8 +51,8 @@ void testMissileSpawnCallback(const packet_t& packet) {
     missileSpawnCallbackCount++;
 
     // Callback handles casting the packet data
-    if (packet.header.data_size >= sizeof(MissileSpawnPacket) && packet.data) {
-        const MissileSpawnPacket* missileData = static_cast<const MissileSpawnPacket*>(packet.data);
+    if (packet.header.data_size >= sizeof(MissileSpawnPacket) && packet.data()) {
+        const MissileSpawnPacket* missileData = static_cast<const MissileSpawnPacket*>(packet.data());
         std::cout << "MissileSpawn callback triggered - ID: " << missileData->missileId
                   << ", Owner: " << missileData->ownerId << std::endl;
     } else {
@@ -93,7 +93,7 @@ int main() {
     );
 
     // Simulate receiving the packet back
-    packetManager.handlePacketBytes(serializedData.get(), serializedSize, (sockaddr_in){});
+    packetManager.handlePacketBytes(serializedData.bytes(), serializedSize, (sockaddr_in){});
 
     // Process received packets
     auto receivedPackets = packetManager.fetchReceivedPackets();
@@ -117,7 +117,7 @@ int main() {
     );
 
     // Simulate receiving the missile packet
-    packetManager.handlePacketBytes(missileSerializedData.get(), serializedSize, (sockaddr_in){});
+    packetManager.handlePacketBytes(missileSerializedData.bytes(), serializedSize, (sockaddr_in){});
 
     // Process received packets
     receivedPackets = packetManager.fetchReceivedPackets();
@@ -133,7 +133,7 @@ int main() {
     );
 
     // Simulate receiving the ping packet
-    packetManager.handlePacketBytes(pingSerializedData.get(), serializedSize, (sockaddr_in){});
+    packetManager.handlePacketBytes(pingSerializedData.bytes(), serializedSize, (sockaddr_in){});
 
     // Process received packets
     receivedPackets = packetManager.fetchReceivedPackets();
@@ -150,7 +150,7 @@ int main() {
     );
 
     // Simulate receiving the type 3 packet
-    packetManager.handlePacketBytes(type3SerializedData.get(), serializedSize, (sockaddr_in){});
+    packetManager.handlePacketBytes(type3SerializedData.bytes(), serializedSize, (sockaddr_in){});
 
     // Process received packets
     receivedPackets = packetManager.fetchReceivedPackets();
@@ -165,7 +165,7 @@ int main() {
         &serializedSize
     );
 
-    packetManager.handlePacketBytes(unregisteredData.get(), serializedSize, (sockaddr_in){});
+    packetManager.handlePacketBytes(unregisteredData.bytes(), serializedSize, (sockaddr_in){});
     receivedPackets = packetManager.fetchReceivedPackets();
     packetHandler.processPackets(receivedPackets); // Should be silently ignored
 